@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assets.h"
+#include "lz.h"
+
+static unsigned char* pool = NULL;
+static unsigned char loaded[MAX_ASSETS];
+
+const unsigned char* loadAsset(const char* name, size_t* size) {
+    for (int i = 0; i < packedAssetCount; i++) {
+        const PackedAsset* asset = &packedAssets[i];
+        if (strcmp(asset->name, name) != 0) continue;
+
+        if (pool == NULL) {
+            pool = malloc(assetPoolSize);
+            if (pool == NULL) {
+                printf("Out of memory for %zu bytes of assets\n", assetPoolSize);
+                return NULL;
+            }
+        }
+        unsigned char* contents = pool + asset->poolOffset;
+        if (!loaded[i]) {
+            if (lzDecompress(asset->data, asset->packedSize, contents, asset->rawSize) != (long)asset->rawSize) {
+                printf("Embedded asset %s is damaged\n", name);
+                return NULL;
+            }
+            loaded[i] = 1;
+        }
+        *size = asset->rawSize;
+        return contents;
+    }
+    printf("No embedded asset named %s\n", name);
+    return NULL;
+}
+
+void freeAssets() {
+    free(pool);
+    pool = NULL;
+    memset(loaded, 0, sizeof(loaded));
+}
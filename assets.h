@@ -0,0 +1,35 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Resources embedded in the game, such as the TTF font of `make TTF=1`
+// builds. packassets compresses them at build time into assetpack.c,
+// which is compiled on its own and only when an asset changes. Each is
+// decompressed the first time it is asked for, into one pool that holds
+// all of them. Game thread only.
+
+#define MAX_ASSETS 32
+
+typedef struct {
+    const char* name; // File name, without the directory
+    const unsigned char* data; // LZ-compressed (lz.h)
+    uint32_t packedSize;
+    uint32_t rawSize;
+    uint32_t poolOffset; // Where it goes in the pool once decompressed
+} PackedAsset;
+
+// Made by packassets
+extern const PackedAsset packedAssets[];
+extern const int packedAssetCount;
+extern const size_t assetPoolSize;
+
+// The asset's contents, decompressed on first use. Returns NULL, with a
+// message, if it isn't packed or can't be decompressed.
+const unsigned char* loadAsset(const char* name, size_t* size);
+
+// Free the pool; pointers from loadAsset are invalid afterwards
+void freeAssets();
+
+#endif // ASSETS_H
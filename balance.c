@@ -0,0 +1,293 @@
+// Monte Carlo balance runner: the bot plays many independent games on
+// every core and the results are summed into histograms of death causes,
+// depth reached, score and turns survived. Seeds come from a range or a
+// file, so two runs with different settings play the same dungeons.
+//
+// Usage: balance [-s first-seed] [-n games] [-f seed-file] [-j threads] [-t max-turns]
+//                [-hunger N] [-regen N] [-rest N] [-resthunger N]
+//                [-monster name:hp:speed:points]...
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bot.h"
+#include "workpool.h"
+
+#define BALANCE_MAX_TURNS 20000
+#define TURN_BUCKET 250   // Turns per histogram bar
+#define TURN_BUCKETS 24
+#define SCORE_BUCKET 500  // Points per histogram bar
+#define SCORE_BUCKETS 16
+#define MAX_CAUSES 16     // Monster types, the boss, starvation, victory, turn limit
+#define HISTOGRAM_WIDTH 50
+
+typedef struct {
+    long long games;
+    long long wins;
+    long long totalTurns;
+    long long totalScore;
+    long long causes[MAX_CAUSES];
+    long long depths[FINAL_DUNGEON_LEVEL + 1];
+    long long turnHistogram[TURN_BUCKETS];
+    long long scoreHistogram[SCORE_BUCKETS];
+} BalanceStats;
+
+typedef struct {
+    const uint64_t* seeds; // NULL: item numbers are the seeds
+    long maxTurns;
+    BalanceStats* stats;   // One per worker, summed at the end
+} BalanceJob;
+
+static const char* causeNames[MAX_CAUSES];
+static int numCauses = 0;
+static int causeStarvation;
+static int causeVictory;
+static int causeTurnLimit;
+
+static int addCause(const char* name) {
+    causeNames[numCauses] = name;
+    return numCauses++;
+}
+
+// Index of a cause of death. Monster names come from the templates, so
+// the table is fixed before any game starts.
+static int causeIndex() {
+    if (gameState == STATE_WIN) return causeVictory;
+    if (gameState != STATE_GAMEOVER) return causeTurnLimit;
+    for (int i = 0; i < numCauses; i++) {
+        if (strcmp(causeNames[i], player.causeOfDeath) == 0) return i;
+    }
+    return causeStarvation;
+}
+
+static void playOne(long long item, int worker, void* userData) {
+    BalanceJob* job = userData;
+    BalanceStats* stats = &job->stats[worker];
+    uint64_t seed = job->seeds != NULL ? job->seeds[item] : (uint64_t)item;
+
+    seedGameRand(seed);
+    newGame();
+    long turns = playBotGame(job->maxTurns);
+
+    stats->games++;
+    stats->wins += gameState == STATE_WIN;
+    stats->totalTurns += turns;
+    stats->totalScore += player.score;
+    stats->causes[causeIndex()]++;
+    stats->depths[dungeonLevel < 1 ? 1 : dungeonLevel > FINAL_DUNGEON_LEVEL ? FINAL_DUNGEON_LEVEL : dungeonLevel]++;
+    long turnBucket = turns / TURN_BUCKET;
+    stats->turnHistogram[turnBucket < TURN_BUCKETS ? turnBucket : TURN_BUCKETS - 1]++;
+    int scoreBucket = player.score / SCORE_BUCKET;
+    stats->scoreHistogram[scoreBucket < SCORE_BUCKETS ? scoreBucket : SCORE_BUCKETS - 1]++;
+}
+
+static void printBar(const char* label, long long count, long long largest, long long games) {
+    int width = largest > 0 ? (int)(count * HISTOGRAM_WIDTH / largest) : 0;
+    printf("  %-16s %10lld %6.2f%% ", label, count, games > 0 ? 100.0 * count / games : 0.0);
+    for (int i = 0; i < width; i++) putchar('#');
+    putchar('\n');
+}
+
+static long long largestOf(const long long* counts, int n) {
+    long long largest = 0;
+    for (int i = 0; i < n; i++) {
+        if (counts[i] > largest) largest = counts[i];
+    }
+    return largest;
+}
+
+static void printReport(const BalanceStats* total) {
+    char label[32];
+    long long games = total->games;
+
+    printf("Games %lld, won %lld (%.2f%%), starved %lld (%.2f%%), average score %.1f, average turns %.1f\n",
+           games, total->wins, games ? 100.0 * total->wins / games : 0.0,
+           total->causes[causeStarvation], games ? 100.0 * total->causes[causeStarvation] / games : 0.0,
+           games ? (double)total->totalScore / games : 0.0, games ? (double)total->totalTurns / games : 0.0);
+
+    printf("\nOutcome\n");
+    long long largest = largestOf(total->causes, numCauses);
+    for (int i = 0; i < numCauses; i++) {
+        if (total->causes[i] == 0) continue;
+        printBar(causeNames[i], total->causes[i], largest, games);
+    }
+
+    printf("\nDepth reached\n");
+    largest = largestOf(total->depths, FINAL_DUNGEON_LEVEL + 1);
+    for (int level = 1; level <= FINAL_DUNGEON_LEVEL; level++) {
+        snprintf(label, sizeof(label), "level %d", level);
+        printBar(label, total->depths[level], largest, games);
+    }
+
+    printf("\nTurns survived\n");
+    largest = largestOf(total->turnHistogram, TURN_BUCKETS);
+    for (int i = 0; i < TURN_BUCKETS; i++) {
+        if (i == TURN_BUCKETS - 1) {
+            snprintf(label, sizeof(label), "%d+", i * TURN_BUCKET);
+        } else {
+            snprintf(label, sizeof(label), "%d-%d", i * TURN_BUCKET, (i + 1) * TURN_BUCKET - 1);
+        }
+        printBar(label, total->turnHistogram[i], largest, games);
+    }
+
+    printf("\nScore\n");
+    largest = largestOf(total->scoreHistogram, SCORE_BUCKETS);
+    for (int i = 0; i < SCORE_BUCKETS; i++) {
+        if (i == SCORE_BUCKETS - 1) {
+            snprintf(label, sizeof(label), "%d+", i * SCORE_BUCKET);
+        } else {
+            snprintf(label, sizeof(label), "%d-%d", i * SCORE_BUCKET, (i + 1) * SCORE_BUCKET - 1);
+        }
+        printBar(label, total->scoreHistogram[i], largest, games);
+    }
+}
+
+// Override a monster template: name:hp:speed:points
+static int setMonster(const char* spec) {
+    char name[20];
+    int hp, speed, points;
+    if (sscanf(spec, "%19[^:]:%d:%d:%d", name, &hp, &speed, &points) != 4) return -1;
+    Monster* target = strcmp(finalBossTemplate.name, name) == 0 ? &finalBossTemplate : NULL;
+    for (int i = 0; i < numMonsterTypes && target == NULL; i++) {
+        if (strcmp(monsterTemplates[i].name, name) == 0) target = &monsterTemplates[i];
+    }
+    if (target == NULL) return -1;
+    target->hp = hp;
+    target->speed = speed;
+    target->points = points;
+    return 0;
+}
+
+// One seed per line
+static uint64_t* readSeeds(const char* path, long long* count) {
+    FILE* in = fopen(path, "r");
+    if (in == NULL) return NULL;
+    long long capacity = 1024;
+    uint64_t* seeds = malloc(sizeof(uint64_t) * capacity);
+    unsigned long long seed;
+    *count = 0;
+    while (seeds != NULL && fscanf(in, "%llu", &seed) == 1) {
+        if (*count == capacity) {
+            capacity *= 2;
+            uint64_t* grown = realloc(seeds, sizeof(uint64_t) * capacity);
+            if (grown == NULL) {
+                free(seeds);
+                seeds = NULL;
+                break;
+            }
+            seeds = grown;
+        }
+        seeds[(*count)++] = seed;
+    }
+    fclose(in);
+    return seeds;
+}
+
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void usage(const char* program) {
+    printf("Usage: %s [-s first-seed] [-n games] [-f seed-file] [-j threads] [-t max-turns]\n"
+           "       [-hunger N] [-regen N] [-rest N] [-resthunger N] [-monster name:hp:speed:points]...\n",
+           program);
+}
+
+int main(int argc, char* argv[]) {
+    long long firstSeed = 1;
+    long long count = 10000;
+    const char* seedFile = NULL;
+    int numWorkers = countProcessors();
+    BalanceJob job;
+    job.seeds = NULL;
+    job.maxTurns = BALANCE_MAX_TURNS;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        } else if (strcmp(argv[i], "-s") == 0) {
+            firstSeed = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "-n") == 0) {
+            count = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0) {
+            seedFile = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0) {
+            numWorkers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0) {
+            job.maxTurns = atol(argv[++i]);
+        } else if (strcmp(argv[i], "-hunger") == 0) {
+            hungerStarving = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-regen") == 0) {
+            passiveRegenInterval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-rest") == 0) {
+            restTurnsRequired = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-resthunger") == 0) {
+            restHunger = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-monster") == 0) {
+            if (setMonster(argv[++i]) != 0) {
+                printf("Unknown monster or bad format in %s (want name:hp:speed:points)\n", argv[i]);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (numWorkers < 1) numWorkers = 1;
+    if (passiveRegenInterval < 1 || restTurnsRequired < 1) {
+        printf("Regeneration and rest intervals must be at least 1\n");
+        return 1;
+    }
+
+    uint64_t* seeds = NULL;
+    long long first = firstSeed;
+    if (seedFile != NULL) {
+        seeds = readSeeds(seedFile, &count);
+        if (seeds == NULL) {
+            printf("Could not read seeds from %s\n", seedFile);
+            return 1;
+        }
+        first = 0;
+        job.seeds = seeds;
+    }
+
+    for (int i = 0; i < numMonsterTypes; i++) {
+        addCause(monsterTemplates[i].name);
+    }
+    addCause(finalBossTemplate.name);
+    causeStarvation = addCause("starvation");
+    causeVictory = addCause("victory");
+    causeTurnLimit = addCause("turn limit");
+
+    job.stats = calloc(numWorkers, sizeof(BalanceStats));
+    if (job.stats == NULL) {
+        printf("Out of memory for %d workers\n", numWorkers);
+        free(seeds);
+        return 1;
+    }
+
+    double start = now();
+    int result = runWorkStealing(first, first + count, numWorkers, playOne, &job);
+    double elapsed = now() - start;
+
+    BalanceStats total;
+    memset(&total, 0, sizeof(total));
+    for (int w = 0; w < numWorkers; w++) {
+        const long long* from = (const long long*)&job.stats[w];
+        long long* to = (long long*)&total;
+        for (size_t i = 0; i < sizeof(BalanceStats) / sizeof(long long); i++) {
+            to[i] += from[i];
+        }
+    }
+    free(job.stats);
+    free(seeds);
+    if (result != 0) return 1;
+
+    printReport(&total);
+    fprintf(stderr, "\n%lld games in %.2f s (%.0f games/min) on %d threads\n",
+            total.games, elapsed, elapsed > 0 ? total.games * 60.0 / elapsed : 0.0, numWorkers);
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Dungeon generation throughput benchmark: random rooms vs. BSP, each
+// with sequential and spanning-tree corridors, and cellular automaton
+// caves. Connectivity validation is timed separately.
+//
+// Usage: bench_gen [seconds-per-case]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+
+typedef struct {
+    const char* name;
+    int width, height;
+    int maxRooms;
+} BenchCase;
+
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void runCase(const BenchCase* c, DungeonGenerator generator, CorridorStyle corridors, double seconds) {
+    DungeonGrid grid;
+    grid.width = c->width;
+    grid.height = c->height;
+    grid.maxRooms = c->maxRooms;
+    grid.tiles = malloc((size_t)c->width * c->height);
+    grid.rooms = malloc(sizeof(Room) * c->maxRooms);
+    int* labels = malloc(sizeof(int) * c->width * c->height);
+    if (grid.tiles == NULL || grid.rooms == NULL || labels == NULL) {
+        printf("Out of memory for %s\n", c->name);
+        exit(1);
+    }
+
+    long levels = 0;
+    long long totalRooms = 0;
+    double repairTime = 0;
+    double start = now();
+    double elapsed;
+    do {
+        memset(grid.tiles, '#', (size_t)c->width * c->height);
+        grid.numRooms = 0;
+        if (generator == GEN_CAVE) {
+            generateCave(&grid, 4);
+        } else if (generator == GEN_BSP) {
+            placeRoomsBSP(&grid);
+        } else {
+            placeRoomsRandom(&grid, c->maxRooms);
+        }
+        if (generator == GEN_CAVE) {
+            // Caves have no corridors
+        } else if (corridors == CORRIDORS_MST) {
+            connectRoomsMST(&grid);
+        } else {
+            connectRooms(&grid);
+        }
+        totalRooms += grid.numRooms;
+        levels++;
+
+        // Validate from the first room, or the middle of a cave
+        double repairStart = now();
+        int spawnX = grid.width / 2;
+        int spawnY = grid.height / 2;
+        if (grid.numRooms > 0) {
+            spawnX = grid.rooms[0].x;
+            spawnY = grid.rooms[0].y;
+        }
+        grid.tiles[spawnY * grid.width + spawnX] = '.';
+        repairConnectivity(&grid, labels, spawnX, spawnY);
+        double repairEnd = now();
+        repairTime += repairEnd - repairStart;
+        elapsed = repairEnd - start - repairTime;
+    } while (elapsed < seconds);
+
+    // Corridor length of the last level: floor tiles outside the rooms
+    // (for caves, all of the floor)
+    long long corridorTiles = 0;
+    for (long long i = 0; i < (long long)c->width * c->height; i++) {
+        corridorTiles += grid.tiles[i] == '.';
+    }
+    for (int i = 0; i < grid.numRooms; i++) {
+        corridorTiles -= grid.rooms[i].width * grid.rooms[i].height;
+    }
+
+    const char* generatorName = generator == GEN_CAVE ? "cave" : generator == GEN_BSP ? "bsp" : "random";
+    const char* corridorName = generator == GEN_CAVE ? "-" : corridors == CORRIDORS_MST ? "mst" : "sequential";
+    printf("%-6s %-7s %-10s %10.1f levels/s %12.1f us/level %9.1f rooms %10lld non-room floor %10.1f us/fill\n",
+           c->name, generatorName, corridorName,
+           levels / elapsed, elapsed * 1e6 / levels, (double)totalRooms / levels, corridorTiles,
+           repairTime * 1e6 / levels);
+
+    free(grid.tiles);
+    free(grid.rooms);
+    free(labels);
+}
+
+int main(int argc, char* argv[]) {
+    double seconds = argc > 1 ? atof(argv[1]) : 1.0;
+    const BenchCase cases[] = {
+        {"game", MAP_WIDTH, MAP_HEIGHT, MAX_ROOMS},
+        {"large", 1000, 1000, 2500},
+        {"huge", 4000, 4000, 40000},
+    };
+
+    seedGameRand(12345);
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        runCase(&cases[i], GEN_RANDOM_ROOMS, CORRIDORS_SEQUENTIAL, seconds);
+        runCase(&cases[i], GEN_RANDOM_ROOMS, CORRIDORS_MST, seconds);
+        runCase(&cases[i], GEN_BSP, CORRIDORS_SEQUENTIAL, seconds);
+        runCase(&cases[i], GEN_BSP, CORRIDORS_MST, seconds);
+        runCase(&cases[i], GEN_CAVE, CORRIDORS_SEQUENTIAL, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,186 @@
+#include <stddef.h>
+#include "bot.h"
+#include "path.h"
+#include "replay.h"
+
+#define BOT_ITEM_RANGE 12   // Steps the bot will detour for an item
+#define BOT_HUNT_RANGE 12   // Steps the bot will walk to fight a monster it can see
+#define BOT_FOOD_MARGIN 40  // Eat this many turns before starving
+#define BOT_MANA_RESERVE 3  // Keep enough mana for a heal
+
+// The monster being hunted. The bot keeps after it until it dies or gets
+// out of reach, even if a step along the path leaves it just out of
+// sight; otherwise exploring would walk straight back, and the bot would
+// pace between two tiles until it starved.
+static _Thread_local int huntTarget = -1;
+static _Thread_local int huntLevel = 0;
+
+static int canSee(int x, int y) {
+    return getDistance(player.x, player.y, x, y) <= player.visibilityRadius;
+}
+
+static int isKnownItem(int x, int y, void* data) {
+    (void)data;
+    return visibility[y][x] && (map[y][x] == '!' || map[y][x] == 'F');
+}
+
+static int isTile(int x, int y, void* data) {
+    const int* target = data;
+    return x == target[0] && y == target[1];
+}
+
+// An explored floor tile next to an unexplored one
+static int isFrontier(int x, int y, void* data) {
+    (void)data;
+    if (!visibility[y][x]) return 0;
+    for (int d = 0; d < 4; d++) {
+        int nx = x + pathDirX[d];
+        int ny = y + pathDirY[d];
+        if (nx >= 0 && nx < MAP_WIDTH && ny >= 0 && ny < MAP_HEIGHT && !visibility[ny][nx]) return 1;
+    }
+    return 0;
+}
+
+static int isMonster(int x, int y, void* data) {
+    int visibleOnly = *(int*)data;
+    int index = isOccupiedByMonster(x, y);
+    return index != -1 && (!visibleOnly || canSee(x, y));
+}
+
+static int isHuntTarget(int x, int y, void* data) {
+    (void)data;
+    return isOccupiedByMonster(x, y) == huntTarget;
+}
+
+static int adjacentMonster(int* dx, int* dy) {
+    for (int d = 0; d < 4; d++) {
+        if (isOccupiedByMonster(player.x + pathDirX[d], player.y + pathDirY[d]) != -1) {
+            *dx = pathDirX[d];
+            *dy = pathDirY[d];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// A direction in which a magic missile would hit a monster within sight
+static int missileTarget(int* dx, int* dy) {
+    for (int d = 0; d < 4; d++) {
+        int x = player.x;
+        int y = player.y;
+        for (int step = 0; step < player.visibilityRadius; step++) {
+            x += pathDirX[d];
+            y += pathDirY[d];
+            if (!isTileWalkable(x, y)) break;
+            if (isOccupiedByMonster(x, y) != -1) {
+                *dx = pathDirX[d];
+                *dy = pathDirY[d];
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int visibleMonsterCount() {
+    int count = 0;
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        count += monsters[i].active && canSee(monsters[i].x, monsters[i].y);
+    }
+    return count;
+}
+
+static Action makeAction(ActionType type, int dx, int dy) {
+    Action action = {type, dx, dy};
+    return action;
+}
+
+Action chooseBotAction() {
+    int dx, dy, goalX, goalY;
+    int hpLow = player.hp * 10 <= player.maxHp * 4;
+    int nextToMonster = adjacentMonster(&dx, &dy);
+    int visibleOnly = 1;
+    int anyMonster = 0;
+
+    // Stay alive first
+    if (hpLow) {
+        if (player.healthPotions > 0) return makeAction(ACTION_POTION, 0, 0);
+        if (player.mana >= 3) return makeAction(ACTION_HEAL, 0, 0);
+        if (nextToMonster && player.mana >= 5) return makeAction(ACTION_PHASE_DOOR, 0, 0);
+    }
+    if (player.foodInInventory > 0 && (player.isStarving || player.hunger >= hungerStarving - BOT_FOOD_MARGIN)) {
+        return makeAction(ACTION_EAT, 0, 0);
+    }
+
+    // Fight: missiles don't draw a counterattack, so prefer them while
+    // there is mana to spare
+    int aimX, aimY;
+    if (player.mana >= 2 + BOT_MANA_RESERVE && missileTarget(&aimX, &aimY)) {
+        return makeAction(ACTION_MISSILE, aimX, aimY);
+    }
+    if (nextToMonster) return makeAction(ACTION_MOVE, dx, dy);
+
+    int monstersInSight = visibleMonsterCount();
+    if (player.hp * 10 < player.maxHp * 6 && monstersInSight == 0 && player.hunger < hungerStarving / 2) {
+        return makeAction(ACTION_REST, 0, 0);
+    }
+
+    // Pick up nearby items, hunt monsters in sight while healthy
+    if (findPath(player.x, player.y, isKnownItem, NULL, BOT_ITEM_RANGE, &dx, &dy, &goalX, &goalY) > 0) {
+        return makeAction(ACTION_MOVE, dx, dy);
+    }
+    int healthy = player.hp * 10 >= player.maxHp * 7;
+    if (huntTarget != -1 && healthy && huntLevel == dungeonLevel && monsters[huntTarget].active &&
+        findPath(player.x, player.y, isHuntTarget, NULL, BOT_HUNT_RANGE, &dx, &dy, &goalX, &goalY) > 0) {
+        return makeAction(ACTION_MOVE, dx, dy);
+    }
+    huntTarget = -1;
+    if (monstersInSight > 0 && healthy &&
+        findPath(player.x, player.y, isMonster, &visibleOnly, BOT_HUNT_RANGE, &dx, &dy, &goalX, &goalY) > 0) {
+        huntTarget = isOccupiedByMonster(goalX, goalY);
+        huntLevel = dungeonLevel;
+        return makeAction(ACTION_MOVE, dx, dy);
+    }
+
+    // Descend once strong enough for the next level, otherwise explore
+    int stairsTile[2];
+    int stairs = dungeonLevel < FINAL_DUNGEON_LEVEL && findKnownStairs(stairsTile) &&
+                 findPath(player.x, player.y, isTile, stairsTile, 0, &dx, &dy, &goalX, &goalY) > 0;
+    if (stairs && player.level >= dungeonLevel) return makeAction(ACTION_MOVE, dx, dy);
+    int stairsX = dx, stairsY = dy;
+    if (findPath(player.x, player.y, isFrontier, NULL, 0, &dx, &dy, &goalX, &goalY) > 0) {
+        return makeAction(ACTION_MOVE, dx, dy);
+    }
+    if (stairs) return makeAction(ACTION_MOVE, stairsX, stairsY);
+
+    // Everything explored: go after whatever is left, such as the Lich Lord
+    if (findPath(player.x, player.y, isMonster, &anyMonster, 0, &dx, &dy, &goalX, &goalY) > 0) {
+        return makeAction(ACTION_MOVE, dx, dy);
+    }
+    return makeAction(ACTION_REST, 0, 0);
+}
+
+long playBotGame(long maxTurns) {
+    long turns = 0;
+    int idle = 0;
+    huntTarget = -1; // Nothing carries over from the thread's last game
+    while (gameState == STATE_PLAYING && turns < maxTurns) {
+        Action action = chooseBotAction();
+        if (idle > 8) {
+            // Every choice was refused (say, resting next to a monster):
+            // step somewhere instead. No gameRand here, so recorded bot
+            // games replay exactly.
+            action = makeAction(ACTION_MOVE, pathDirX[idle % 4], pathDirY[idle % 4]);
+        }
+        recordAction(action); // No-ops unless a recording was started
+        int turnPassed = playTurn(action);
+        recordTurnEnd();
+        turns += turnPassed;
+        idle = turnPassed ? 0 : idle + 1;
+        pendingSounds = 0;
+        if (gameState == STATE_LEVELUP) {
+            gameState = STATE_PLAYING;
+        }
+    }
+    return turns;
+}
@@ -0,0 +1,15 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include "game.h"
+
+// Pick the bot's next action from what the player can see: the explored
+// map, monsters within sight and the character's own stats. It also
+// remembers which monster it is hunting, per thread.
+Action chooseBotAction();
+
+// Let the bot play the current game until the player dies, wins or
+// `maxTurns` turns have passed. Returns the number of turns played.
+long playBotGame(long maxTurns);
+
+#endif // BOT_H
@@ -0,0 +1,199 @@
+// Bulk dungeon generator: builds one level per seed with the game's own
+// generateDungeon/placeMonsters on every core and streams per-level
+// statistics to a CSV or binary file, for balancing and seed curation.
+//
+// Usage: bulkgen [-s first-seed] [-n count] [-l level] [-j threads] [-b] [-o file]
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+#include "workpool.h"
+
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+#define BULK_MAGIC "DHBG"
+#define BULK_VERSION 1
+
+// One record per seed; the binary format is a header followed by these
+typedef struct {
+    uint64_t seed;
+    int32_t level;
+    int32_t rooms;
+    int32_t floorArea;
+    int32_t stairsDistance; // Steps from the player to the stairs, -1 if none
+    int32_t monsters;
+    float monsterDensity;   // Monsters per 100 floor tiles
+} DungeonStats;
+
+typedef struct {
+    char data[OUTPUT_BUFFER_SIZE];
+    size_t used;
+} OutputBuffer;
+
+typedef struct {
+    int level;
+    int binary;
+    FILE* out;
+    pthread_mutex_t outLock;
+    OutputBuffer* buffers; // One per worker
+} BulkJob;
+
+// Shortest walk from the player to the stairs, -1 if there are none
+static int stairsDistance() {
+    static _Thread_local int distance[MAP_HEIGHT * MAP_WIDTH];
+    static _Thread_local int queue[MAP_HEIGHT * MAP_WIDTH];
+    static const int dirX[4] = {1, -1, 0, 0};
+    static const int dirY[4] = {0, 0, 1, -1};
+    int head = 0;
+    int tail = 0;
+
+    memset(distance, 0xFF, sizeof(distance));
+    distance[player.y * MAP_WIDTH + player.x] = 0;
+    queue[tail++] = player.y * MAP_WIDTH + player.x;
+    while (head < tail) {
+        int current = queue[head++];
+        int x = current % MAP_WIDTH;
+        int y = current / MAP_WIDTH;
+        if (map[y][x] == '>') return distance[current];
+        for (int d = 0; d < 4; d++) {
+            int nx = x + dirX[d];
+            int ny = y + dirY[d];
+            if (nx < 0 || nx >= MAP_WIDTH || ny < 0 || ny >= MAP_HEIGHT || map[ny][nx] == '#') continue;
+            int next = ny * MAP_WIDTH + nx;
+            if (distance[next] >= 0) continue;
+            distance[next] = distance[current] + 1;
+            queue[tail++] = next;
+        }
+    }
+    return -1;
+}
+
+static void flushBuffer(BulkJob* job, OutputBuffer* buffer) {
+    if (buffer->used == 0) return;
+    pthread_mutex_lock(&job->outLock);
+    fwrite(buffer->data, 1, buffer->used, job->out);
+    pthread_mutex_unlock(&job->outLock);
+    buffer->used = 0;
+}
+
+static void generateOne(long long seed, int worker, void* userData) {
+    BulkJob* job = userData;
+    OutputBuffer* buffer = &job->buffers[worker];
+
+    seedGameRand((uint64_t)seed);
+    dungeonLevel = job->level;
+    generateDungeon();
+    placeMonsters();
+
+    DungeonStats stats;
+    stats.seed = (uint64_t)seed;
+    stats.level = dungeonLevel;
+    stats.rooms = numRooms;
+    stats.floorArea = 0;
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            stats.floorArea += map[y][x] != '#';
+        }
+    }
+    stats.stairsDistance = stairsDistance();
+    stats.monsters = 0;
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        stats.monsters += monsters[i].active;
+    }
+    stats.monsterDensity = stats.floorArea > 0 ? 100.0f * stats.monsters / stats.floorArea : 0.0f;
+
+    if (buffer->used + 128 > OUTPUT_BUFFER_SIZE) {
+        flushBuffer(job, buffer);
+    }
+    if (job->binary) {
+        memcpy(buffer->data + buffer->used, &stats, sizeof(stats));
+        buffer->used += sizeof(stats);
+    } else {
+        buffer->used += snprintf(buffer->data + buffer->used, OUTPUT_BUFFER_SIZE - buffer->used,
+                                 "%llu,%d,%d,%d,%d,%d,%.4f\n", (unsigned long long)stats.seed, stats.level,
+                                 stats.rooms, stats.floorArea, stats.stairsDistance, stats.monsters,
+                                 stats.monsterDensity);
+    }
+}
+
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    long long firstSeed = 1;
+    long long count = 100000;
+    int numWorkers = countProcessors();
+    const char* outPath = NULL;
+    BulkJob job;
+    job.level = 1;
+    job.binary = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-b") == 0) {
+            job.binary = 1;
+        } else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) {
+            firstSeed = atoll(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+            count = atoll(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-l") == 0) {
+            job.level = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-j") == 0) {
+            numWorkers = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+            outPath = argv[++i];
+        } else {
+            printf("Usage: %s [-s first-seed] [-n count] [-l level] [-j threads] [-b] [-o file]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (job.level < 1 || job.level > FINAL_DUNGEON_LEVEL) {
+        printf("Level must be between 1 and %d\n", FINAL_DUNGEON_LEVEL);
+        return 1;
+    }
+    if (numWorkers < 1) numWorkers = 1;
+    if (outPath == NULL) outPath = job.binary ? "dungeons.bin" : "dungeons.csv";
+
+    job.out = fopen(outPath, job.binary ? "wb" : "w");
+    if (job.out == NULL) {
+        printf("Could not open %s for writing\n", outPath);
+        return 1;
+    }
+    job.buffers = malloc(sizeof(OutputBuffer) * numWorkers);
+    if (job.buffers == NULL) {
+        printf("Out of memory for %d output buffers\n", numWorkers);
+        fclose(job.out);
+        return 1;
+    }
+    for (int i = 0; i < numWorkers; i++) {
+        job.buffers[i].used = 0;
+    }
+    pthread_mutex_init(&job.outLock, NULL);
+
+    if (job.binary) {
+        uint32_t header[2] = {BULK_VERSION, sizeof(DungeonStats)};
+        fwrite(BULK_MAGIC, 1, 4, job.out);
+        fwrite(header, sizeof(header), 1, job.out);
+    } else {
+        fprintf(job.out, "seed,level,rooms,floor_area,stairs_distance,monsters,monsters_per_100_tiles\n");
+    }
+
+    double start = now();
+    int result = runWorkStealing(firstSeed, firstSeed + count, numWorkers, generateOne, &job);
+    for (int i = 0; i < numWorkers; i++) {
+        flushBuffer(&job, &job.buffers[i]);
+    }
+    double elapsed = now() - start;
+
+    fclose(job.out);
+    pthread_mutex_destroy(&job.outLock);
+    free(job.buffers);
+    if (result != 0) return 1;
+
+    fprintf(stderr, "Generated %lld level-%d dungeons in %.2f s (%.0f/s) on %d threads -> %s\n",
+            count, job.level, elapsed, count / elapsed, numWorkers, outPath);
+    return 0;
+}
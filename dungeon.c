@@ -0,0 +1,836 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "game.h"
+
+// Room size limits shared by the room generators
+#define ROOM_MIN_WIDTH 5
+#define ROOM_MAX_WIDTH 14
+#define ROOM_MIN_HEIGHT 4
+#define ROOM_MAX_HEIGHT 11
+
+// Partitions smaller than this can't hold a room plus its wall margin
+#define BSP_MIN_LEAF_WIDTH (ROOM_MIN_WIDTH + 2)
+#define BSP_MIN_LEAF_HEIGHT (ROOM_MIN_HEIGHT + 2)
+#define BSP_STACK_SIZE 64
+
+// Candidate neighbours per room for the spanning tree
+#define MST_NEIGHBOURS 6
+// One extra loop corridor per this many rooms
+#define MST_ROOMS_PER_LOOP 8
+
+// Cave generation: initial wall density is 7/16, then this many passes
+// of the 4-5 rule (a cell becomes wall with 5+ walls in its 3x3 block)
+#define CAVE_SMOOTHING_PASSES 4
+
+#define TILE(grid, x, y) ((grid)->tiles[(y) * (grid)->width + (x)])
+
+static void placeCaveEndpoints(DungeonGrid* grid);
+
+// Procedurally generate a dungeon with rooms and corridors
+void generateDungeon() {
+    // Fill map with walls
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            map[y][x] = '#';
+        }
+    }
+
+    // Create the level with the generator chosen for this depth
+    DungeonGrid grid = {&map[0][0], MAP_WIDTH, MAP_HEIGHT, rooms, 0, MAX_ROOMS};
+    DungeonGenerator generator = GEN_RANDOM_ROOMS;
+    if (dungeonLevel >= 1 && dungeonLevel <= FINAL_DUNGEON_LEVEL) {
+        generator = levelGenerators[dungeonLevel];
+    }
+    if (generator == GEN_CAVE) {
+        generateCave(&grid, CAVE_SMOOTHING_PASSES);
+        placeCaveEndpoints(&grid);
+    } else {
+        if (generator == GEN_BSP) {
+            placeRoomsBSP(&grid);
+        } else {
+            placeRoomsRandom(&grid, MAX_ROOMS);
+        }
+
+        // Connect the rooms
+        if (corridorStyle == CORRIDORS_MST) {
+            connectRoomsMST(&grid);
+        } else {
+            connectRooms(&grid);
+        }
+    }
+    numRooms = grid.numRooms;
+
+    // Place the player in the center of the first room
+    if (numRooms > 0) {
+        player.x = rooms[0].x + rooms[0].width / 2;
+        player.y = rooms[0].y + rooms[0].height / 2;
+    } else {
+        // If no rooms were created, place the player in a safe default location
+        player.x = MAP_WIDTH / 2;
+        player.y = MAP_HEIGHT / 2;
+        map[player.y][player.x] = '.';
+    }
+
+    // Fill or tunnel to anything the player can't reach
+    playerRegion = repairConnectivity(&grid, &regionLabels[0][0], player.x, player.y);
+
+    // Place potions and food
+    placePotions();
+    placeFood();
+
+    // Place stairs down if not the final level
+    if (numRooms > 1 && dungeonLevel < 5) {
+        int lastRoomIndex = numRooms - 1;
+        int stairsX = rooms[lastRoomIndex].x + rooms[lastRoomIndex].width / 2;
+        int stairsY = rooms[lastRoomIndex].y + rooms[lastRoomIndex].height / 2;
+        map[stairsY][stairsX] = '>';
+    }
+
+    // Initialize visibility map
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            visibility[y][x] = 0;
+        }
+    }
+    mapVersion++;
+}
+
+// Helper function to carve out a room and record it in the grid
+void createRoom(DungeonGrid* grid, int x, int y, int width, int height) {
+    for (int i = y; i < y + height; i++) {
+        for (int j = x; j < x + width; j++) {
+            TILE(grid, j, i) = '.';
+        }
+    }
+    Room* room = &grid->rooms[grid->numRooms++];
+    room->x = x;
+    room->y = y;
+    room->width = width;
+    room->height = height;
+}
+
+// Try `attempts` random rectangles, dropping those that collide.
+// Only rooms have been carved at this point, so the tiles under a
+// candidate are the spatial index: testing its footprint costs the
+// room's area instead of a pass over every earlier room.
+void placeRoomsRandom(DungeonGrid* grid, int attempts) {
+    for (int i = 0; i < attempts && grid->numRooms < grid->maxRooms; i++) {
+        int roomWidth = gameRand() % (ROOM_MAX_WIDTH - ROOM_MIN_WIDTH + 1) + ROOM_MIN_WIDTH;
+        int roomHeight = gameRand() % (ROOM_MAX_HEIGHT - ROOM_MIN_HEIGHT + 1) + ROOM_MIN_HEIGHT;
+
+        // Ensure rooms are within map boundaries
+        int roomX = gameRand() % (grid->width - roomWidth - 2) + 1;
+        int roomY = gameRand() % (grid->height - roomHeight - 2) + 1;
+
+        // Check for overlap with existing rooms
+        int overlaps = 0;
+        for (int y = roomY; y < roomY + roomHeight && !overlaps; y++) {
+            for (int x = roomX; x < roomX + roomWidth; x++) {
+                if (TILE(grid, x, y) != '#') {
+                    overlaps = 1;
+                    break;
+                }
+            }
+        }
+
+        if (!overlaps) {
+            createRoom(grid, roomX, roomY, roomWidth, roomHeight);
+        }
+    }
+}
+
+// Carve one room inside a BSP leaf, keeping a wall margin on every side
+static void createRoomInLeaf(DungeonGrid* grid, const Room* leaf) {
+    int maxWidth = leaf->width - 2 < ROOM_MAX_WIDTH ? leaf->width - 2 : ROOM_MAX_WIDTH;
+    int maxHeight = leaf->height - 2 < ROOM_MAX_HEIGHT ? leaf->height - 2 : ROOM_MAX_HEIGHT;
+    int roomWidth = gameRand() % (maxWidth - ROOM_MIN_WIDTH + 1) + ROOM_MIN_WIDTH;
+    int roomHeight = gameRand() % (maxHeight - ROOM_MIN_HEIGHT + 1) + ROOM_MIN_HEIGHT;
+    int roomX = leaf->x + 1 + gameRand() % (leaf->width - 2 - roomWidth + 1);
+    int roomY = leaf->y + 1 + gameRand() % (leaf->height - 2 - roomHeight + 1);
+    createRoom(grid, roomX, roomY, roomWidth, roomHeight);
+}
+
+// Recursively split the map and put one room in each leaf. Leaves are
+// disjoint, so rooms can't overlap and no collision test is needed.
+// A partition is only split while it is at least 2.5x the target leaf
+// area; with cuts between 40% and 60% every leaf then keeps at least the
+// target area, which bounds the room count by maxRooms. Leaves come off
+// the stack depth-first, so consecutive rooms are spatial neighbours.
+void placeRoomsBSP(DungeonGrid* grid) {
+    Room stack[BSP_STACK_SIZE];
+    int top = 0;
+    long long targetArea;
+
+    stack[top++] = (Room){1, 1, grid->width - 2, grid->height - 2};
+    if (stack[0].width < BSP_MIN_LEAF_WIDTH || stack[0].height < BSP_MIN_LEAF_HEIGHT || grid->maxRooms <= 0) {
+        return;
+    }
+    targetArea = (long long)stack[0].width * stack[0].height / grid->maxRooms;
+
+    while (top > 0 && grid->numRooms < grid->maxRooms) {
+        Room leaf = stack[--top];
+        long long area = (long long)leaf.width * leaf.height;
+        int canSplitX = leaf.width >= 2 * BSP_MIN_LEAF_WIDTH;
+        int canSplitY = leaf.height >= 2 * BSP_MIN_LEAF_HEIGHT;
+
+        if (area * 2 < targetArea * 5 || (!canSplitX && !canSplitY) || top + 2 > BSP_STACK_SIZE) {
+            createRoomInLeaf(grid, &leaf);
+            continue;
+        }
+
+        // Cut across the longer side, measured in minimum leaf sizes
+        int splitX = canSplitX && (!canSplitY ||
+            leaf.width * BSP_MIN_LEAF_HEIGHT >= leaf.height * BSP_MIN_LEAF_WIDTH);
+        int length = splitX ? leaf.width : leaf.height;
+        int minLength = splitX ? BSP_MIN_LEAF_WIDTH : BSP_MIN_LEAF_HEIGHT;
+        int cut = length * (gameRand() % 21 + 40) / 100;
+        if (cut < minLength) cut = minLength;
+        if (cut > length - minLength) cut = length - minLength;
+
+        Room first = leaf;
+        Room second = leaf;
+        if (splitX) {
+            first.width = cut;
+            second.x += cut;
+            second.width -= cut;
+        } else {
+            first.height = cut;
+            second.y += cut;
+            second.height -= cut;
+        }
+        // Push the second half first so the first half is carved next
+        stack[top++] = second;
+        stack[top++] = first;
+    }
+}
+
+// Carve an L-shaped corridor: horizontal leg first, then vertical
+static void carveCorridor(DungeonGrid* grid, int x1, int y1, int x2, int y2) {
+    // Carve horizontal corridor
+    if (x1 < x2) {
+        for (int x = x1; x <= x2; x++) {
+            TILE(grid, x, y1) = '.';
+        }
+    } else {
+        for (int x = x2; x <= x1; x++) {
+            TILE(grid, x, y1) = '.';
+        }
+    }
+
+    // Carve vertical corridor
+    if (y1 < y2) {
+        for (int y = y1; y <= y2; y++) {
+            TILE(grid, x2, y) = '.';
+        }
+    } else {
+        for (int y = y2; y <= y1; y++) {
+            TILE(grid, x2, y) = '.';
+        }
+    }
+}
+
+// Connect the rooms with corridors
+void connectRooms(DungeonGrid* grid) {
+    for (int i = 0; i < grid->numRooms - 1; i++) {
+        const Room* a = &grid->rooms[i];
+        const Room* b = &grid->rooms[i + 1];
+        carveCorridor(grid, a->x + a->width / 2, a->y + a->height / 2,
+                      b->x + b->width / 2, b->y + b->height / 2);
+    }
+}
+
+typedef struct {
+    int a, b;
+    int length;
+} RoomEdge;
+
+static int compareEdges(const void* lhs, const void* rhs) {
+    const RoomEdge* e1 = lhs;
+    const RoomEdge* e2 = rhs;
+    if (e1->length != e2->length) return e1->length - e2->length;
+    if (e1->a != e2->a) return e1->a - e2->a;
+    return e1->b - e2->b;
+}
+
+static int findRoot(int* parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static int roomDistance(const Room* a, const Room* b) {
+    return abs((a->x + a->width / 2) - (b->x + b->width / 2)) +
+           abs((a->y + a->height / 2) - (b->y + b->height / 2));
+}
+
+static void carveEdge(DungeonGrid* grid, const RoomEdge* edge) {
+    const Room* a = &grid->rooms[edge->a];
+    const Room* b = &grid->rooms[edge->b];
+    carveCorridor(grid, a->x + a->width / 2, a->y + a->height / 2,
+                  b->x + b->width / 2, b->y + b->height / 2);
+}
+
+// Connect the rooms along a minimum spanning tree of their centers.
+// Distances are Manhattan, which is exactly the length of the L-shaped
+// corridor between two centers. Instead of a Delaunay triangulation the
+// candidate edges are each room's nearest neighbours, found through a
+// bucket grid, so the pass stays O(n log n) for thousands of rooms. A
+// few of the leftover candidates are carved as well to give the level
+// some loops.
+void connectRoomsMST(DungeonGrid* grid) {
+    int n = grid->numRooms;
+    if (n < 2) return;
+
+    // Bucket the room centers into roughly one room per cell
+    int cellSize = (int)sqrt((double)grid->width * grid->height / n);
+    if (cellSize < 1) cellSize = 1;
+    int cols = grid->width / cellSize + 1;
+    int rows = grid->height / cellSize + 1;
+
+    int* cellStart = calloc((size_t)cols * rows + 1, sizeof(int));
+    int* cellRooms = malloc(sizeof(int) * n);
+    int* parent = malloc(sizeof(int) * n);
+    RoomEdge* edges = malloc(sizeof(RoomEdge) * n * MST_NEIGHBOURS);
+    if (cellStart == NULL || cellRooms == NULL || parent == NULL || edges == NULL) {
+        printf("Out of memory building corridors, falling back to sequential ones\n");
+        free(cellStart);
+        free(cellRooms);
+        free(parent);
+        free(edges);
+        connectRooms(grid);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        const Room* r = &grid->rooms[i];
+        int cell = (r->y + r->height / 2) / cellSize * cols + (r->x + r->width / 2) / cellSize;
+        cellStart[cell + 1]++;
+    }
+    for (int c = 0; c < cols * rows; c++) {
+        cellStart[c + 1] += cellStart[c];
+    }
+    for (int i = 0; i < n; i++) {
+        const Room* r = &grid->rooms[i];
+        int cell = (r->y + r->height / 2) / cellSize * cols + (r->x + r->width / 2) / cellSize;
+        cellRooms[cellStart[cell]++] = i;
+    }
+    // The fill pass advanced each start to the next cell's start; shift back
+    for (int c = cols * rows; c > 0; c--) {
+        cellStart[c] = cellStart[c - 1];
+    }
+    cellStart[0] = 0;
+
+    // Collect each room's nearest neighbours, searching rings of cells
+    // outwards until nothing unsearched can be closer
+    int numEdges = 0;
+    for (int i = 0; i < n; i++) {
+        const Room* r = &grid->rooms[i];
+        int cx = (r->x + r->width / 2) / cellSize;
+        int cy = (r->y + r->height / 2) / cellSize;
+        RoomEdge nearest[MST_NEIGHBOURS];
+        int found = 0;
+
+        for (int ring = 0; ring < cols || ring < rows; ring++) {
+            for (int y = cy - ring; y <= cy + ring; y++) {
+                if (y < 0 || y >= rows) continue;
+                int step = (y == cy - ring || y == cy + ring) ? 1 : 2 * ring;
+                for (int x = cx - ring; x <= cx + ring; x += step > 0 ? step : 1) {
+                    if (x < 0 || x >= cols) continue;
+                    int cell = y * cols + x;
+                    for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+                        int j = cellRooms[k];
+                        if (j == i) continue;
+                        RoomEdge edge = {i < j ? i : j, i < j ? j : i, roomDistance(r, &grid->rooms[j])};
+                        if (found == MST_NEIGHBOURS && edge.length >= nearest[found - 1].length) continue;
+                        // Insertion into the sorted neighbour list
+                        int pos = found < MST_NEIGHBOURS ? found++ : found - 1;
+                        while (pos > 0 && nearest[pos - 1].length > edge.length) {
+                            nearest[pos] = nearest[pos - 1];
+                            pos--;
+                        }
+                        nearest[pos] = edge;
+                    }
+                }
+            }
+            if (found == MST_NEIGHBOURS && nearest[found - 1].length <= ring * cellSize) break;
+        }
+        for (int k = 0; k < found; k++) {
+            edges[numEdges++] = nearest[k];
+        }
+    }
+
+    // Kruskal over the candidates; neighbour lists overlap, so skip duplicates
+    qsort(edges, numEdges, sizeof(RoomEdge), compareEdges);
+    for (int i = 0; i < n; i++) {
+        parent[i] = i;
+    }
+    int numLeftover = 0;
+    for (int e = 0; e < numEdges; e++) {
+        if (e > 0 && edges[e].a == edges[e - 1].a && edges[e].b == edges[e - 1].b) continue;
+        int rootA = findRoot(parent, edges[e].a);
+        int rootB = findRoot(parent, edges[e].b);
+        if (rootA != rootB) {
+            parent[rootA] = rootB;
+            carveEdge(grid, &edges[e]);
+        } else {
+            edges[numLeftover++] = edges[e];
+        }
+    }
+
+    // Neighbour graphs are almost always connected, but clustered layouts
+    // can split them; join any stray group to the nearest room of the first
+    for (int i = 1; i < n; i++) {
+        if (findRoot(parent, i) == findRoot(parent, 0)) continue;
+        int best = 0;
+        for (int j = 0; j < n; j++) {
+            if (findRoot(parent, j) == findRoot(parent, 0) &&
+                roomDistance(&grid->rooms[i], &grid->rooms[j]) < roomDistance(&grid->rooms[i], &grid->rooms[best])) {
+                best = j;
+            }
+        }
+        RoomEdge edge = {i, best, 0};
+        parent[findRoot(parent, i)] = findRoot(parent, 0);
+        carveEdge(grid, &edge);
+    }
+
+    // Loops: a few random leftover candidates
+    for (int loops = n / MST_ROOMS_PER_LOOP + 1; loops > 0 && numLeftover > 0; loops--) {
+        int pick = gameRand() % numLeftover;
+        carveEdge(grid, &edges[pick]);
+        edges[pick] = edges[--numLeftover];
+    }
+
+    free(cellStart);
+    free(cellRooms);
+    free(parent);
+    free(edges);
+}
+
+// xorshift64* generator for bulk random bits
+static uint64_t nextRandomWord(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+// One smoothing pass over bit-packed rows (bit set = wall, bit i of word
+// w is cell 64 * w + i). The 3x3 wall count is summed with bit-sliced
+// adders, so each word operation updates 64 cells at once. Cells beyond
+// the edges read as walls.
+static void smoothCaveRows(const uint64_t* src, uint64_t* dst, int height, int rowWords) {
+    const uint64_t solid = ~0ULL;
+    for (int y = 0; y < height; y++) {
+        const uint64_t* up = y > 0 ? src + (size_t)(y - 1) * rowWords : NULL;
+        const uint64_t* mid = src + (size_t)y * rowWords;
+        const uint64_t* down = y < height - 1 ? src + (size_t)(y + 1) * rowWords : NULL;
+        uint64_t* out = dst + (size_t)y * rowWords;
+
+        for (int i = 0; i < rowWords; i++) {
+            uint64_t ones[3], twos[3];
+            const uint64_t* rows3[3] = {up, mid, down};
+            for (int r = 0; r < 3; r++) {
+                const uint64_t* row = rows3[r];
+                uint64_t c = row ? row[i] : solid;
+                uint64_t prev = row && i > 0 ? row[i - 1] : solid;
+                uint64_t next = row && i < rowWords - 1 ? row[i + 1] : solid;
+                uint64_t w = (c << 1) | (prev >> 63);
+                uint64_t e = (c >> 1) | (next << 63);
+                // Full adder: w + c + e = 2 * twos + ones
+                ones[r] = w ^ c ^ e;
+                twos[r] = (w & c) | (e & (w ^ c));
+            }
+            // Sum of the nine cells as bit0 + 2 * bit1 + 4 * bit2 + 8 * bit3
+            uint64_t bit0 = ones[0] ^ ones[1] ^ ones[2];
+            uint64_t carry = (ones[0] & ones[1]) | (ones[2] & (ones[0] ^ ones[1]));
+            uint64_t t = twos[0] ^ twos[1] ^ twos[2];
+            uint64_t u = (twos[0] & twos[1]) | (twos[2] & (twos[0] ^ twos[1]));
+            uint64_t bit1 = t ^ carry;
+            uint64_t carry2 = t & carry;
+            uint64_t bit2 = u ^ carry2;
+            uint64_t bit3 = u & carry2;
+            // Wall when the count is 5 or more
+            out[i] = bit3 | (bit2 & (bit1 | bit0));
+        }
+    }
+}
+
+// Keep the outer ring of cells and the padding past the last column solid
+static void sealCaveEdges(uint64_t* cells, int width, int height, int rowWords) {
+    int lastWord = (width - 1) / 64;
+    uint64_t padding = (width % 64) ? ~0ULL << (width % 64) : 0;
+    for (int y = 0; y < height; y++) {
+        uint64_t* row = cells + (size_t)y * rowWords;
+        if (y == 0 || y == height - 1) {
+            for (int i = 0; i < rowWords; i++) row[i] = ~0ULL;
+            continue;
+        }
+        row[0] |= 1ULL;
+        row[lastWord] |= (1ULL << ((width - 1) % 64)) | padding;
+    }
+}
+
+// Generate a cave level with a cellular automaton. The grid's rooms are
+// cleared; callers that need spawn points pick them from the floor.
+void generateCave(DungeonGrid* grid, int smoothingPasses) {
+    int rowWords = (grid->width + 63) / 64;
+    size_t numWords = (size_t)rowWords * grid->height;
+    uint64_t* cells = malloc(numWords * sizeof(uint64_t));
+    uint64_t* scratch = malloc(numWords * sizeof(uint64_t));
+    grid->numRooms = 0;
+    if (cells == NULL || scratch == NULL) {
+        printf("Out of memory generating cave\n");
+        free(cells);
+        free(scratch);
+        memset(grid->tiles, '#', (size_t)grid->width * grid->height);
+        return;
+    }
+
+    // Random fill: a & (b | c | d) sets each bit with probability 7/16
+    uint64_t state = ((uint64_t)gameRand() << 32) ^ (uint64_t)gameRand() ^ 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < numWords; i++) {
+        uint64_t a = nextRandomWord(&state);
+        uint64_t b = nextRandomWord(&state);
+        uint64_t c = nextRandomWord(&state);
+        uint64_t d = nextRandomWord(&state);
+        cells[i] = a & (b | c | d);
+    }
+    sealCaveEdges(cells, grid->width, grid->height, rowWords);
+
+    for (int pass = 0; pass < smoothingPasses; pass++) {
+        smoothCaveRows(cells, scratch, grid->height, rowWords);
+        sealCaveEdges(scratch, grid->width, grid->height, rowWords);
+        uint64_t* swap = cells;
+        cells = scratch;
+        scratch = swap;
+    }
+
+    // Unpack a byte of cells at a time through a lookup table
+    static _Thread_local char unpacked[256][8];
+    static _Thread_local int unpackedReady = 0;
+    if (!unpackedReady) {
+        for (int b = 0; b < 256; b++) {
+            for (int j = 0; j < 8; j++) {
+                unpacked[b][j] = (b >> j) & 1 ? '#' : '.';
+            }
+        }
+        unpackedReady = 1;
+    }
+    for (int y = 0; y < grid->height; y++) {
+        const uint64_t* row = cells + (size_t)y * rowWords;
+        char* tiles = &TILE(grid, 0, y);
+        int x = 0;
+        for (; x + 8 <= grid->width; x += 8) {
+            memcpy(tiles + x, unpacked[(row[x / 64] >> (x % 64)) & 0xFF], 8);
+        }
+        for (; x < grid->width; x++) {
+            tiles[x] = (row[x / 64] >> (x % 64)) & 1 ? '#' : '.';
+        }
+    }
+
+    free(cells);
+    free(scratch);
+}
+
+// Floor tile closest to (targetX, targetY), carving one if the cave is solid
+static void findCaveFloor(DungeonGrid* grid, int targetX, int targetY, int* outX, int* outY) {
+    int best = -1;
+    *outX = targetX;
+    *outY = targetY;
+    for (int y = 1; y < grid->height - 1; y++) {
+        for (int x = 1; x < grid->width - 1; x++) {
+            int distance = abs(x - targetX) + abs(y - targetY);
+            if (TILE(grid, x, y) == '.' && (best < 0 || distance < best)) {
+                best = distance;
+                *outX = x;
+                *outY = y;
+            }
+        }
+    }
+    TILE(grid, *outX, *outY) = '.';
+}
+
+// Caves have no rooms. The spawn (west end) and exit (east end) are
+// recorded as single-tile rooms so the room-based placement in
+// generateDungeon and placeMonsters keeps working, and a corridor
+// between them guarantees the exit is reachable.
+static void placeCaveEndpoints(DungeonGrid* grid) {
+    int spawnX, spawnY, exitX, exitY;
+    findCaveFloor(grid, grid->width / 8, grid->height / 2, &spawnX, &spawnY);
+    findCaveFloor(grid, grid->width - grid->width / 8, grid->height / 2, &exitX, &exitY);
+    carveCorridor(grid, spawnX, spawnY, exitX, exitY);
+
+    grid->numRooms = 0;
+    if (grid->maxRooms < 2) return;
+    grid->rooms[grid->numRooms++] = (Room){spawnX, spawnY, 1, 1};
+    grid->rooms[grid->numRooms++] = (Room){exitX, exitY, 1, 1};
+}
+
+typedef struct {
+    int* items;
+    int count;
+    int capacity;
+} IndexStack;
+
+static int pushIndex(IndexStack* stack, int index) {
+    if (stack->count == stack->capacity) {
+        int capacity = stack->capacity ? stack->capacity * 2 : 256;
+        int* items = realloc(stack->items, sizeof(int) * capacity);
+        if (items == NULL) return 0;
+        stack->items = items;
+        stack->capacity = capacity;
+    }
+    stack->items[stack->count++] = index;
+    return 1;
+}
+
+// Label the connected floor regions with a scanline flood fill: each seed
+// grows into a whole horizontal span, and only the start of each
+// unlabelled run above and below is pushed. Walls get 0, regions 1..n.
+// Returns the number of regions, or -1 if memory ran out.
+int labelRegions(const DungeonGrid* grid, int* labels) {
+    int width = grid->width;
+    int height = grid->height;
+    int numRegions = 0;
+    IndexStack stack = {NULL, 0, 0}; // (x, y) pairs
+
+    memset(labels, 0, sizeof(int) * width * height);
+    for (int startY = 0; startY < height; startY++) {
+        const char* startRow = grid->tiles + (size_t)startY * width;
+        const int* startLabels = labels + (size_t)startY * width;
+        for (int startX = 0; startX < width; startX++) {
+            if (startRow[startX] == '#' || startLabels[startX] != 0) continue;
+            numRegions++;
+            if (!pushIndex(&stack, startX) || !pushIndex(&stack, startY)) {
+                free(stack.items);
+                return -1;
+            }
+
+            while (stack.count > 0) {
+                int y = stack.items[--stack.count];
+                int x1 = stack.items[--stack.count];
+                int x2 = x1;
+                const char* row = grid->tiles + (size_t)y * width;
+                int* rowLabels = labels + (size_t)y * width;
+                if (rowLabels[x1] != 0) continue;
+                while (x1 > 0 && row[x1 - 1] != '#' && rowLabels[x1 - 1] == 0) x1--;
+                while (x2 < width - 1 && row[x2 + 1] != '#' && rowLabels[x2 + 1] == 0) x2++;
+                for (int x = x1; x <= x2; x++) {
+                    rowLabels[x] = numRegions;
+                }
+
+                for (int ny = y - 1; ny <= y + 1; ny += 2) {
+                    if (ny < 0 || ny >= height) continue;
+                    const char* nrow = grid->tiles + (size_t)ny * width;
+                    const int* nlabels = labels + (size_t)ny * width;
+                    int inRun = 0;
+                    for (int x = x1; x <= x2; x++) {
+                        int open = nrow[x] != '#' && nlabels[x] == 0;
+                        if (open && !inRun && (!pushIndex(&stack, x) || !pushIndex(&stack, ny))) {
+                            free(stack.items);
+                            return -1;
+                        }
+                        inRun = open;
+                    }
+                }
+            }
+        }
+    }
+
+    free(stack.items);
+    return numRegions;
+}
+
+// Make every floor tile reachable from (x, y): regions smaller than
+// MIN_REGION_SIZE are filled with wall, larger ones are tunnelled to.
+// One breadth-first search from the player's region, crossing walls,
+// gives every tile its shortest way back; each stray region is then
+// joined from its closest tile. Leaves `labels` describing the repaired
+// grid and returns the label of the region containing (x, y).
+int repairConnectivity(DungeonGrid* grid, int* labels, int x, int y) {
+    static const int dirX[4] = {1, -1, 0, 0};
+    static const int dirY[4] = {0, 0, 1, -1};
+    int width = grid->width;
+    int size = width * grid->height;
+    int numRegions = labelRegions(grid, labels);
+    int mainRegion = labels[y * width + x];
+    if (numRegions <= 1) return mainRegion;
+
+    int* regionSizes = calloc(numRegions + 1, sizeof(int));
+    int* closestTile = malloc(sizeof(int) * (numRegions + 1));
+    int* queue = malloc(sizeof(int) * size);
+    unsigned char* cameFrom = malloc(size);
+    if (regionSizes == NULL || closestTile == NULL || queue == NULL || cameFrom == NULL) {
+        printf("Out of memory checking connectivity\n");
+        free(regionSizes);
+        free(closestTile);
+        free(queue);
+        free(cameFrom);
+        return mainRegion;
+    }
+
+    int head = 0;
+    int tail = 0;
+    memset(cameFrom, 0xFF, size);
+    for (int i = 0; i < size; i++) {
+        regionSizes[labels[i]]++;
+        if (labels[i] == mainRegion) {
+            cameFrom[i] = 4; // Search root
+            queue[tail++] = i;
+        }
+    }
+    int unreached = 0;
+    for (int r = 0; r <= numRegions; r++) {
+        closestTile[r] = -1;
+        if (r != 0 && r != mainRegion && regionSizes[r] >= MIN_REGION_SIZE) unreached++;
+    }
+
+    // The first tile of each region to come off the queue is its closest
+    while (head < tail && unreached > 0) {
+        int current = queue[head++];
+        int region = labels[current];
+        if (region != mainRegion && region != 0 && closestTile[region] < 0) {
+            closestTile[region] = current;
+            if (regionSizes[region] >= MIN_REGION_SIZE) unreached--;
+        }
+        int cx = current % width;
+        int cy = current / width;
+        for (int d = 0; d < 4; d++) {
+            int nx = cx + dirX[d];
+            int ny = cy + dirY[d];
+            // Stay inside the outer wall
+            if (nx < 1 || nx >= width - 1 || ny < 1 || ny >= grid->height - 1) continue;
+            int next = ny * width + nx;
+            if (cameFrom[next] != 0xFF) continue;
+            cameFrom[next] = d;
+            queue[tail++] = next;
+        }
+    }
+
+    // Tunnel from each large stray region back along the search
+    for (int r = 1; r <= numRegions; r++) {
+        if (r == mainRegion || regionSizes[r] < MIN_REGION_SIZE || closestTile[r] < 0) continue;
+        int step = closestTile[r];
+        while (cameFrom[step] != 4) {
+            int d = cameFrom[step];
+            step -= dirX[d] + dirY[d] * width;
+            if (labels[step] == mainRegion) break;
+            grid->tiles[step] = '.';
+            labels[step] = -1; // Joined below
+        }
+    }
+
+    for (int i = 0; i < size; i++) {
+        int region = labels[i];
+        if (region == 0 || region == mainRegion) continue;
+        if (region > 0 && regionSizes[region] < MIN_REGION_SIZE) {
+            grid->tiles[i] = '#';
+            labels[i] = 0;
+        } else {
+            labels[i] = mainRegion;
+        }
+    }
+
+    free(regionSizes);
+    free(closestTile);
+    free(queue);
+    free(cameFrom);
+    return mainRegion;
+}
+
+// Place monsters in the dungeon
+void placeMonsters() {
+    if (dungeonLevel == 5) {
+        // Place the final boss on level 5
+        monsters[0] = finalBossTemplate;
+        monsters[0].hp = finalBossTemplate.hp * 2; // Make boss even stronger
+        monsters[0].points = finalBossTemplate.points * 2; // More points for the boss
+        monsters[0].active = 1;
+
+        int placed = 0;
+        int attempt = 0;
+        while (!placed && attempt < 100) {
+            int x = rooms[numRooms-1].x + rooms[numRooms-1].width / 2;
+            int y = rooms[numRooms-1].y + rooms[numRooms-1].height / 2;
+            if (map[y][x] == '.' && (x != player.x || y != player.y)) {
+                monsters[0].x = x;
+                monsters[0].y = y;
+                placed = 1;
+            }
+            attempt++;
+        }
+        for (int i = 1; i < MAX_MONSTERS; i++) {
+            monsters[i].active = 0; // Deactivate other monsters on the final level
+        }
+
+    } else {
+        for (int i = 0; i < MAX_MONSTERS; i++) {
+            // Randomly choose a monster type from the templates
+            int type = gameRand() % numMonsterTypes;
+            monsters[i] = monsterTemplates[type];
+            monsters[i].active = 1; // All monsters are active
+
+            // Scale monster stats with dungeon level
+            monsters[i].hp += dungeonLevel * 2;
+            monsters[i].points += dungeonLevel * 5;
+
+            // Find a random valid floor tile to place the monster
+            int placed = 0;
+            int attempt = 0;
+            while (!placed && attempt < 100) {
+                int x = gameRand() % MAP_WIDTH;
+                int y = gameRand() % MAP_HEIGHT;
+                if (map[y][x] == '.' && regionLabels[y][x] == playerRegion && (x != player.x || y != player.y)) {
+                    monsters[i].x = x;
+                    monsters[i].y = y;
+                    placed = 1;
+                }
+                attempt++;
+            }
+            if (!placed) {
+                monsters[i].active = 0; // If no space is found, deactivate the monster
+            }
+        }
+    }
+}
+
+// Place potions on the floor
+void placePotions() {
+    if (gameRand() % 3 == 0) { // 33% chance to place a potion on a new level
+        // Skipped if the player's region has no room for it
+        int placed = 0;
+        int attempt = 0;
+        while (!placed && attempt < 100) {
+            int x = gameRand() % MAP_WIDTH;
+            int y = gameRand() % MAP_HEIGHT;
+            if (map[y][x] == '.' && regionLabels[y][x] == playerRegion && (x != player.x || y != player.y)) {
+                map[y][x] = '!'; // Potion symbol
+                placed = 1;
+            }
+            attempt++;
+        }
+    }
+}
+
+// Place food on the floor
+void placeFood() {
+    if (gameRand() % 2 == 0) { // 50% chance to place food on a new level
+        // Skipped if the player's region has no room for it
+        int placed = 0;
+        int attempt = 0;
+        while (!placed && attempt < 100) {
+            int x = gameRand() % MAP_WIDTH;
+            int y = gameRand() % MAP_HEIGHT;
+            if (map[y][x] == '.' && regionLabels[y][x] == playerRegion && (x != player.x || y != player.y)) {
+                map[y][x] = 'F'; // Food symbol
+                placed = 1;
+            }
+            attempt++;
+        }
+    }
+}
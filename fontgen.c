@@ -0,0 +1,106 @@
+// Build step: rasterize the printable ASCII glyphs of the game's font
+// at TILE_SIZE pixels and write them as a C header, so the game can draw
+// text without loading the TTF at startup. Glyphs are rendered the way
+// TTF_RenderText_Solid renders them: hinted for monochrome, one bit per
+// pixel, each in a cell one advance wide and one line high.
+//
+// The output is committed, so building the game doesn't need FreeType;
+// `make fontatlas` regenerates it after the font or TILE_SIZE changes.
+//
+// Usage: fontgen font.ttf > fontatlas.h
+#include <stdio.h>
+#include <string.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "game.h"
+
+#define FIRST_GLYPH ' '
+#define LAST_GLYPH '~'
+#define GLYPH_COUNT (LAST_GLYPH - FIRST_GLYPH + 1)
+#define MAX_CELL 64
+
+static unsigned char cells[GLYPH_COUNT][MAX_CELL][MAX_CELL / 8];
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s font.ttf > fontatlas.h\n", argv[0]);
+        return 1;
+    }
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0) {
+        fprintf(stderr, "Could not initialize FreeType\n");
+        return 1;
+    }
+    if (FT_New_Face(library, argv[1], 0, &face) != 0) {
+        fprintf(stderr, "Could not load the font %s\n", argv[1]);
+        return 1;
+    }
+    // SDL_ttf's point size at its default 72 DPI: one point per pixel
+    if (FT_Set_Char_Size(face, 0, TILE_SIZE * 64, 0, 0) != 0) {
+        fprintf(stderr, "Could not size the font to %d pixels\n", TILE_SIZE);
+        return 1;
+    }
+
+    int ascent = (int)(face->size->metrics.ascender >> 6);
+    int height = (int)((face->size->metrics.ascender - face->size->metrics.descender) >> 6);
+    int width = 0;
+    for (int c = FIRST_GLYPH; c <= LAST_GLYPH; c++) {
+        if (FT_Load_Char(face, c, FT_LOAD_TARGET_MONO) == 0 && (int)(face->glyph->advance.x >> 6) > width) {
+            width = (int)(face->glyph->advance.x >> 6);
+        }
+    }
+    if (width <= 0 || width > MAX_CELL || height <= 0 || height > MAX_CELL) {
+        fprintf(stderr, "Glyph cells of %dx%d pixels don't fit\n", width, height);
+        return 1;
+    }
+
+    for (int c = FIRST_GLYPH; c <= LAST_GLYPH; c++) {
+        if (FT_Load_Char(face, c, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO) != 0 ||
+            face->glyph->bitmap.pixel_mode != FT_PIXEL_MODE_MONO) {
+            fprintf(stderr, "Could not render glyph '%c'\n", c);
+            return 1;
+        }
+        const FT_Bitmap* bitmap = &face->glyph->bitmap;
+        int left = face->glyph->bitmap_left;
+        int top = ascent - face->glyph->bitmap_top;
+        for (int row = 0; row < (int)bitmap->rows; row++) {
+            for (int column = 0; column < (int)bitmap->width; column++) {
+                int x = left + column;
+                int y = top + row;
+                const unsigned char* bits = bitmap->buffer + row * bitmap->pitch;
+                if (x < 0 || x >= width || y < 0 || y >= height || !(bits[column / 8] & (0x80 >> (column % 8)))) {
+                    continue;
+                }
+                cells[c - FIRST_GLYPH][y][x / 8] |= (unsigned char)(0x80 >> (x % 8));
+            }
+        }
+    }
+
+    int stride = (width + 7) / 8;
+    printf("// Generated by fontgen from %s; do not edit. Printable ASCII at\n", argv[1]);
+    printf("// %d pixels, one bit per pixel, most significant bit leftmost.\n", TILE_SIZE);
+    printf("#define FONT_ATLAS_SIZE %d // The TILE_SIZE it was made for\n", TILE_SIZE);
+    printf("#define FONT_ATLAS_FIRST %d\n", FIRST_GLYPH);
+    printf("#define FONT_ATLAS_LAST %d\n", LAST_GLYPH);
+    printf("#define FONT_ATLAS_WIDTH %d // Advance of every glyph\n", width);
+    printf("#define FONT_ATLAS_HEIGHT %d // Line height\n", height);
+    printf("#define FONT_ATLAS_STRIDE %d // Bytes per glyph row\n\n", stride);
+    printf("static const unsigned char fontAtlas[%d][FONT_ATLAS_HEIGHT][FONT_ATLAS_STRIDE] = {\n", GLYPH_COUNT);
+    for (int c = FIRST_GLYPH; c <= LAST_GLYPH; c++) {
+        printf("    { // '%s%c'\n", c == '\\' || c == '\'' ? "\\" : "", c);
+        for (int y = 0; y < height; y++) {
+            printf("        {");
+            for (int i = 0; i < stride; i++) {
+                printf("%s0x%02x", i > 0 ? ", " : "", cells[c - FIRST_GLYPH][y][i]);
+            }
+            printf("},\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
@@ -0,0 +1,754 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "game.h"
+#include "projectile.h"
+#include "trace.h"
+
+// Monster templates with scoring
+Monster monsterTemplates[] = {
+    {0, 0, 5, 'g', "Goblin", 1, 2, 10, 0},
+    {0, 0, 15, 'O', "Ogre", 1, 1, 50, 0},
+    {0, 0, 10, 'o', "Orc", 1, 1, 20, 0},
+    {0, 0, 8, 's', "Snake", 1, 3, 15, 0},
+    {0, 0, 25, 'D', "Dragon", 1, 1, 100, 0},
+    {0, 0, 12, 'E', "Poisonous Eye", 1, 2, 40, 1}
+};
+
+Monster finalBossTemplate = {0, 0, 100, 'L', "Lich Lord", 1, 1, 500, 1};
+
+const int numMonsterTypes = sizeof(monsterTemplates) / sizeof(Monster);
+
+// Game state variables
+_Thread_local Player player;
+_Thread_local Monster monsters[MAX_MONSTERS];
+_Thread_local Room rooms[MAX_ROOMS];
+_Thread_local int numRooms = 0;
+_Thread_local char map[MAP_HEIGHT][MAP_WIDTH];
+_Thread_local int dungeonLevel = 1;
+
+// Explored tiles: 1 if the player has seen the tile
+_Thread_local int visibility[MAP_HEIGHT][MAP_WIDTH];
+
+// Connected floor regions of the current level (0 = wall), and the
+// region the player starts in. Everything reachable shares its label.
+_Thread_local int regionLabels[MAP_HEIGHT][MAP_WIDTH];
+_Thread_local int playerRegion = 0;
+
+_Thread_local MessageLog messageLog;
+_Thread_local int turnCounter = 0; // New turn counter for passive regeneration
+_Thread_local int restCounter = 0; // Counter for resting
+_Thread_local GameState gameState = STATE_PLAYING;
+
+// Presentation left for the frontend by the last turn
+_Thread_local Effect effects[MAX_EFFECTS];
+_Thread_local int numEffects = 0;
+_Thread_local unsigned int pendingSounds = 0;
+_Thread_local unsigned int mapVersion = 0;
+
+// Random number generator state (xorshift64*)
+_Thread_local uint64_t rngState = 0x9E3779B97F4A7C15ULL;
+
+// Level layout used by generateDungeon, indexed by dungeonLevel
+DungeonGenerator levelGenerators[FINAL_DUNGEON_LEVEL + 1] = {
+    GEN_RANDOM_ROOMS, // unused, levels start at 1
+    GEN_RANDOM_ROOMS,
+    GEN_RANDOM_ROOMS,
+    GEN_RANDOM_ROOMS,
+    GEN_CAVE,
+    GEN_RANDOM_ROOMS
+};
+CorridorStyle corridorStyle = CORRIDORS_MST;
+
+// Balance settings, tunable by tools such as the balance runner
+int hungerStarving = HUNGER_STARVING;
+int passiveRegenInterval = PASSIVE_REGEN_INTERVAL;
+int restTurnsRequired = REST_TURNS_REQUIRED;
+int restHunger = REST_HUNGER;
+
+// Seed the generator. The seed is scrambled (splitmix64) so that
+// consecutive seeds give unrelated streams.
+void seedGameRand(uint64_t seed) {
+    seed += 0x9E3779B97F4A7C15ULL;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+    seed ^= seed >> 31;
+    rngState = seed ? seed : 1; // xorshift must never be all zero
+}
+
+// Next random number in 0..GAME_RAND_MAX
+int gameRand() {
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return (int)((rngState * 0x2545F4914F6CDD1DULL) >> 33);
+}
+
+
+// Start a new game: a fresh character on the first level
+void newGame() {
+    memset(&player, 0, sizeof(player));
+    player.hp = 20;
+    player.maxHp = 20;
+    player.mana = 10;
+    player.maxMana = 10;
+    player.intelligence = 5;
+    player.score = 0;
+    player.healthPotions = 0;
+    player.foodInInventory = 10; // Start with 10 food items
+    player.level = 1;
+    player.xp = 0;
+    player.xpToNextLevel = 150; // Increased XP threshold
+    player.hunger = 0;
+    player.visibilityRadius = 8; // Default visibility radius
+    player.causeOfDeath[0] = '\0';
+    player.isStarving = 0;
+    player.turnsToHunger = HUNGER_TURN_THRESHOLD;
+
+    dungeonLevel = 1;
+    turnCounter = 0;
+    restCounter = 0;
+    memset(&messageLog, 0, sizeof(messageLog));
+    numEffects = 0;
+    pendingSounds = 0;
+    gameState = STATE_PLAYING;
+
+    // Generate the initial dungeon and place monsters
+    generateDungeon();
+    placeMonsters();
+    updateVisibility();
+}
+
+// Carry out a player action and, if it used up the turn, let the rest
+// of the dungeon act. Returns 1 if a turn passed.
+int playTurn(Action action) {
+    TRACE_SCOPE("playTurn");
+    numEffects = 0;
+    messageLog.turnHasMessages = 0;
+    int turnPassed = performAction(action);
+    if (turnPassed) {
+        endTurn();
+    }
+    checkGameEnd();
+    return turnPassed;
+}
+
+// The first monster the player can see, or -1
+static int monsterInSight() {
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        if (monsters[i].active && getDistance(player.x, player.y, monsters[i].x, monsters[i].y) <= player.visibilityRadius) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Which tiles to the left and right of a run are open, as two bits; a
+// change means a side passage or the end of a corridor
+static int runSides(int dx, int dy) {
+    return isTileWalkable(player.x + dy, player.y + dx) | isTileWalkable(player.x - dy, player.y - dx) << 1;
+}
+
+int startRepeat(RepeatCommand* command, Action action, int followPath) {
+    char tempBuffer[256];
+    int seen = monsterInSight();
+    if (seen != -1) {
+        snprintf(tempBuffer, sizeof(tempBuffer), "You can't %s with the %s in view!",
+                 action.type == ACTION_REST ? "rest" : followPath ? "travel" : "run", monsters[seen].name);
+        showMessage(tempBuffer);
+        return 0;
+    }
+    if (action.type == ACTION_REST && player.hp >= player.maxHp && player.mana >= player.maxMana) {
+        showMessage("You are already fully rested.");
+        return 0;
+    }
+    command->action = action;
+    command->turns = 0;
+    command->hp = player.hp;
+    command->level = dungeonLevel;
+    command->items = player.healthPotions + player.foodInInventory;
+    command->sides = 0;
+    command->followPath = followPath;
+    return 1;
+}
+
+int continueRepeat(RepeatCommand* command, int turnPassed) {
+    char tempBuffer[256];
+    command->turns += turnPassed;
+    if (!turnPassed || gameState != STATE_PLAYING || dungeonLevel != command->level ||
+        command->turns >= MAX_REPEAT_TURNS) {
+        return 0;
+    }
+    // Hurt, by a monster or by hunger: the turn's own message says how
+    if (player.hp < command->hp) {
+        return 0;
+    }
+    command->hp = player.hp;
+    int seen = monsterInSight();
+    if (seen != -1) {
+        snprintf(tempBuffer, sizeof(tempBuffer), "The %s comes into view.", monsters[seen].name);
+        showMessage(tempBuffer);
+        return 0;
+    }
+
+    if (command->action.type == ACTION_REST) {
+        if (player.hp >= player.maxHp && player.mana >= player.maxMana) {
+            snprintf(tempBuffer, sizeof(tempBuffer), "You rest for %d turns and feel fully recovered.", command->turns);
+            showMessage(tempBuffer);
+            return 0;
+        }
+        return 1;
+    }
+    if (command->followPath) return 1; // The path decides where to stop
+
+    // Running: stop on a pickup, before a wall or the stairs, and where
+    // the walls beside the path change. The first step may leave a
+    // doorway or corridor, so the walls are compared from there on.
+    int items = player.healthPotions + player.foodInInventory;
+    if (items != command->items) return 0;
+    int aheadX = player.x + command->action.dx;
+    int aheadY = player.y + command->action.dy;
+    if (!isTileWalkable(aheadX, aheadY) || map[aheadY][aheadX] == '>') return 0;
+    int sides = runSides(command->action.dx, command->action.dy);
+    if (command->turns > 1 && sides != command->sides) return 0;
+    command->sides = sides;
+    return 1;
+}
+
+// Carry out one player action. Returns 1 if it used up the turn.
+int performAction(Action action) {
+    switch (action.type) {
+        case ACTION_MOVE:
+            return movePlayer(player.x + action.dx, player.y + action.dy);
+        case ACTION_REST:
+            if (isOccupiedByMonster(player.x-1, player.y) != -1 || isOccupiedByMonster(player.x+1, player.y) != -1 ||
+                isOccupiedByMonster(player.x, player.y-1) != -1 || isOccupiedByMonster(player.x, player.y+1) != -1) {
+                    showMessage("You can't rest while adjacent to a monster!");
+                    return 0;
+            }
+            rest();
+            player.hunger += restHunger; // Resting makes you hungrier
+            return 1; // A turn has passed
+        case ACTION_HEAL:
+            castHealSpell();
+            return 1;
+        case ACTION_MISSILE:
+            castMagicMissile(action.dx, action.dy);
+            return 1; // A turn has passed
+        case ACTION_PHASE_DOOR:
+            castPhaseDoorSpell();
+            return 1; // A turn has passed
+        case ACTION_EAT:
+            eatFood();
+            return 1;
+        case ACTION_POTION:
+            useHealthPotion();
+            return 1;
+        default:
+            return 0; // No action taken
+    }
+}
+
+// Step onto a tile: descend, pick up items, or attack a monster there
+int movePlayer(int newX, int newY) {
+    // Check if the new position is a floor tile and not a wall
+    if (newX >= 0 && newX < MAP_WIDTH && newY >= 0 && newY < MAP_HEIGHT && map[newY][newX] != '#') {
+
+        // Check for stairs
+        if (map[newY][newX] == '>') {
+            dungeonLevel++;
+            generateDungeon();
+            placeMonsters();
+            showMessage("You descend to a new level!");
+            return 1;
+        }
+
+        // Check for potion
+        if (map[newY][newX] == '!') {
+            player.healthPotions++;
+            pendingSounds |= SOUND_PICKUP;
+            map[newY][newX] = '.';
+            mapVersion++;
+            showMessage("You found a health potion!");
+        }
+
+        // Check for food
+        if (map[newY][newX] == 'F') {
+            player.foodInInventory++;
+            pendingSounds |= SOUND_PICKUP;
+            map[newY][newX] = '.';
+            mapVersion++;
+            showMessage("You found some food!");
+        }
+
+        // Check for a monster in the new position
+        int monsterIndex = -1;
+        for (int i = 0; i < MAX_MONSTERS; i++) {
+            if (monsters[i].active && monsters[i].x == newX && monsters[i].y == newY) {
+                monsterIndex = i;
+                break;
+            }
+        }
+
+        if (monsterIndex != -1) {
+            // Monster found, initiate combat
+            fightMonster(monsterIndex);
+            return 1; // A turn has passed
+        } else {
+            // No monster, move the player
+            player.x = newX;
+            player.y = newY;
+            return 1; // A turn has passed
+        }
+    }
+    return 0; // Blocked by a wall
+}
+
+// Everything that happens after the player has used up their turn
+void endTurn() {
+    moveMonsters();
+    // Count down until this turn's messages leave the screen
+    if (messageLog.recentTurnsLeft > 0) {
+        messageLog.recentTurnsLeft--;
+        if (messageLog.recentTurnsLeft == 0) {
+            messageLog.firstRecent = messageLog.count;
+        }
+    }
+
+    // Hunger mechanic
+    player.hunger++;
+    if (player.hunger >= hungerStarving) {
+        player.hp--;
+        if (player.isStarving == 0) {
+            pendingSounds |= SOUND_BEEP; // Play beep once
+            showMessage("You are starving!");
+            player.isStarving = 1;
+        }
+    } else {
+        player.isStarving = 0; // Reset starving flag
+    }
+
+    // Passive regeneration
+    turnCounter++;
+    if (turnCounter >= passiveRegenInterval) {
+        if (player.hp < player.maxHp) {
+            player.hp++;
+        }
+        if (player.mana < player.maxMana) {
+            player.mana++;
+        }
+        turnCounter = 0;
+    }
+
+    checkLevelUp(); // Check for level up after every turn
+    updateVisibility(); // Update visibility after every turn
+}
+
+// Check for game over or win condition
+void checkGameEnd() {
+    if (player.hp <= 0 && gameState != STATE_GAMEOVER) {
+        gameState = STATE_GAMEOVER;
+        // Blows and bolts name the killer; otherwise hunger did it
+        if (player.causeOfDeath[0] == '\0') {
+            strncpy(player.causeOfDeath, "starvation", sizeof(player.causeOfDeath) - 1);
+            player.causeOfDeath[sizeof(player.causeOfDeath) - 1] = '\0';
+        }
+    }
+
+    // Win condition: dungeon level 5 and the boss is defeated
+    if (dungeonLevel >= 5) {
+        int bossIsAlive = 0;
+        for (int i = 0; i < MAX_MONSTERS; i++) {
+            if (monsters[i].active && strcmp(monsters[i].name, "Lich Lord") == 0) {
+                bossIsAlive = 1;
+                break;
+            }
+        }
+        if (!bossIsAlive && gameState != STATE_WIN) {
+            gameState = STATE_WIN;
+        }
+    }
+}
+
+// Monster movement AI
+void moveMonsters() {
+    TRACE_SCOPE("moveMonsters");
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        // Casters with a clear shot spend their turn on it
+        if (monsters[i].active && !fireProjectile(i)) {
+            // Monsters move based on their speed
+            for (int j = 0; j < monsters[i].speed; j++) {
+                // Check if player is in range
+                if (getDistance(monsters[i].x, monsters[i].y, player.x, player.y) <= MONSTER_DETECTION_RANGE) {
+                    int dx = player.x - monsters[i].x;
+                    int dy = player.y - monsters[i].y;
+                    int newX = monsters[i].x;
+                    int newY = monsters[i].y;
+                    int moved = 0;
+                    
+                    // Prioritize movement on the axis with the greater distance
+                    if (abs(dx) > abs(dy)) {
+                        newX += (dx > 0) ? 1 : -1;
+                        if (newX >= 0 && newX < MAP_WIDTH && newY >= 0 && newY < MAP_HEIGHT &&
+                            map[newY][newX] != '#' && (newX != player.x || newY != player.y) &&
+                            isOccupiedByMonster(newX, newY) == -1) {
+                            monsters[i].x = newX;
+                            moved = 1;
+                        }
+                    } else {
+                        newY += (dy > 0) ? 1 : -1;
+                        if (newX >= 0 && newX < MAP_WIDTH && newY >= 0 && newY < MAP_HEIGHT &&
+                            map[newY][newX] != '#' && (newX != player.x || newY != player.y) &&
+                            isOccupiedByMonster(newX, newY) == -1) {
+                            monsters[i].y = newY;
+                            moved = 1;
+                        }
+                    }
+
+                    // If the primary move failed, try the secondary move
+                    if (!moved) {
+                        if (abs(dx) > abs(dy)) {
+                            newY = monsters[i].y + ((dy > 0) ? 1 : -1);
+                            if (newY >= 0 && newY < MAP_HEIGHT &&
+                                map[newY][monsters[i].x] != '#' &&
+                                (monsters[i].x != player.x || newY != player.y) &&
+                                isOccupiedByMonster(monsters[i].x, newY) == -1) {
+                                monsters[i].y = newY;
+                            }
+                        } else {
+                            newX = monsters[i].x + ((dx > 0) ? 1 : -1);
+                            if (newX >= 0 && newX < MAP_WIDTH &&
+                                map[monsters[i].y][newX] != '#' &&
+                                (newX != player.x || monsters[i].y != player.y) &&
+                                isOccupiedByMonster(newX, monsters[i].y) == -1) {
+                                monsters[i].x = newX;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    resolveProjectiles();
+}
+
+// Handle combat between player and monster
+void fightMonster(int monsterIndex) {
+    char tempBuffer[256];
+    int playerDamage = gameRand() % (player.intelligence * 2) + 1;
+    monsters[monsterIndex].hp -= playerDamage;
+    snprintf(tempBuffer, sizeof(tempBuffer), "You hit the %s for %d damage!", monsters[monsterIndex].name, playerDamage);
+    showMessage(tempBuffer);
+
+    if (monsters[monsterIndex].hp <= 0) {
+        player.score += monsters[monsterIndex].points;
+        player.xp += monsters[monsterIndex].points; // Gain XP for defeating a monster
+        
+        // 50% chance to drop a food item
+        if (gameRand() % 2 == 0) {
+            player.foodInInventory++;
+            snprintf(tempBuffer, sizeof(tempBuffer), "You defeated the %s and found some food!", monsters[monsterIndex].name);
+        } else {
+            snprintf(tempBuffer, sizeof(tempBuffer), "You defeated the %s!", monsters[monsterIndex].name);
+        }
+        monsters[monsterIndex].active = 0;
+        showMessage(tempBuffer);
+    } else {
+        int monsterDamage = gameRand() % (5 + dungeonLevel) + 1; // Monsters do 1-5 damage + dungeon level
+        player.hp -= monsterDamage;
+        pendingSounds |= SOUND_HIT;
+        if (player.hp <= 0) {
+            strncpy(player.causeOfDeath, monsters[monsterIndex].name, sizeof(player.causeOfDeath) - 1);
+            player.causeOfDeath[sizeof(player.causeOfDeath) - 1] = '\0';
+        }
+        snprintf(tempBuffer, sizeof(tempBuffer), "The %s hits you for %d damage! Your HP is now %d/%d.", monsters[monsterIndex].name, monsterDamage, player.hp, player.maxHp);
+        showMessage(tempBuffer);
+    }
+}
+
+// New rest function to recover HP and Mana
+void rest() {
+    char tempBuffer[256];
+    restCounter++;
+    if (restCounter >= restTurnsRequired) {
+        player.hp++;
+        if (player.hp > player.maxHp) player.hp = player.maxHp;
+        player.mana++;
+        if (player.mana > player.maxMana) player.mana = player.maxMana;
+        restCounter = 0;
+        snprintf(tempBuffer, sizeof(tempBuffer), "You have rested and recovered 1 HP and 1 Mana!");
+    } else {
+        snprintf(tempBuffer, sizeof(tempBuffer), "Resting... (Turn %d/%d)", restCounter, restTurnsRequired);
+    }
+    showMessage(tempBuffer);
+}
+
+// New healing spell
+void castHealSpell() {
+    char tempBuffer[256];
+    int manaCost = 3;
+    if (player.mana >= manaCost) {
+        player.mana -= manaCost;
+        int healAmount = gameRand() % 5 + 3 + player.intelligence; // Heal for 3-7 + int amount
+        player.hp += healAmount;
+        if (player.hp > player.maxHp) {
+            player.hp = player.maxHp;
+        }
+        snprintf(tempBuffer, sizeof(tempBuffer), "You cast a healing spell and recover %d HP!", healAmount);
+    } else {
+        snprintf(tempBuffer, sizeof(tempBuffer), "Not enough mana to cast the healing spell!");
+    }
+    showMessage(tempBuffer);
+}
+
+// New magic missile spell
+void castMagicMissile(int dx, int dy) {
+    char tempBuffer[256];
+    int manaCost = 2;
+    if (player.mana < manaCost) {
+        snprintf(tempBuffer, sizeof(tempBuffer), "Not enough mana to cast magic missile!");
+        showMessage(tempBuffer);
+        return;
+    }
+
+    player.mana -= manaCost;
+    pendingSounds |= SOUND_MISSILE;
+    
+    // Fly the missile
+    int missileX = player.x;
+    int missileY = player.y;
+
+    while(1) {
+        missileX += dx;
+        missileY += dy;
+
+        // Check for collision with wall or map boundaries
+        if (missileX < 0 || missileX >= MAP_WIDTH || missileY < 0 || missileY >= MAP_HEIGHT || map[missileY][missileX] == '#') {
+            snprintf(tempBuffer, sizeof(tempBuffer), "The magic missile hits a wall!");
+            break;
+        }
+
+        // Check for collision with monster
+        int monsterIndex = isOccupiedByMonster(missileX, missileY);
+        if (monsterIndex != -1) {
+            int damage = gameRand() % 5 + 1 + player.intelligence;
+            monsters[monsterIndex].hp -= damage;
+            snprintf(tempBuffer, sizeof(tempBuffer), "You cast magic missile at the %s for %d damage!", monsters[monsterIndex].name, damage);
+            if (monsters[monsterIndex].hp <= 0) {
+                player.score += monsters[monsterIndex].points;
+                player.xp += monsters[monsterIndex].points; // Gain XP for defeating a monster
+                
+                snprintf(tempBuffer, sizeof(tempBuffer), "You defeated the %s!", monsters[monsterIndex].name);
+                monsters[monsterIndex].active = 0;
+            }
+            break;
+        }
+
+        // Queue a frame of the missile's flight for the frontend
+        queueEffect(nextEffectFrame(), missileX, missileY, '*');
+    }
+
+    showMessage(tempBuffer);
+}
+
+// New Phase Door spell
+void castPhaseDoorSpell() {
+    char tempBuffer[256];
+    int manaCost = 5;
+    if (player.mana < manaCost) {
+        snprintf(tempBuffer, sizeof(tempBuffer), "Not enough mana to cast Phase Door!");
+        showMessage(tempBuffer);
+        return;
+    }
+
+    player.mana -= manaCost;
+
+    // Find a random, empty, walkable tile to teleport to
+    int newX, newY;
+    int attempts = 0;
+    do {
+        newX = gameRand() % MAP_WIDTH;
+        newY = gameRand() % MAP_HEIGHT;
+        attempts++;
+        if (attempts > 1000) {
+            snprintf(tempBuffer, sizeof(tempBuffer), "The spell fails to find a safe location!");
+            showMessage(tempBuffer);
+            return;
+        }
+    } while (!isTileWalkable(newX, newY) || isOccupiedByMonster(newX, newY) != -1);
+    
+    player.x = newX;
+    player.y = newY;
+    
+    snprintf(tempBuffer, sizeof(tempBuffer), "You cast Phase Door and teleport to a new location!");
+    showMessage(tempBuffer);
+}
+
+// New function to use a health potion
+void useHealthPotion() {
+    char tempBuffer[256];
+    if (player.healthPotions > 0) {
+        player.healthPotions--;
+        int healAmount = gameRand() % 8 + 5; // Heal for 5-12 HP
+        player.hp += healAmount;
+        if (player.hp > player.maxHp) {
+            player.hp = player.maxHp;
+        }
+        snprintf(tempBuffer, sizeof(tempBuffer), "You use a health potion and recover %d HP!", healAmount);
+    } else {
+        snprintf(tempBuffer, sizeof(tempBuffer), "You have no health potions!");
+    }
+    showMessage(tempBuffer);
+}
+
+// New function to eat food
+void eatFood() {
+    char tempBuffer[256];
+    if (player.foodInInventory > 0) {
+        player.foodInInventory--;
+        player.hunger = 0;
+        snprintf(tempBuffer, sizeof(tempBuffer), "You eat the food and are no longer hungry!");
+    } else {
+        snprintf(tempBuffer, sizeof(tempBuffer), "You have no food!");
+    }
+    showMessage(tempBuffer);
+}
+
+// Check if player has enough XP to level up
+void checkLevelUp() {
+    TRACE_SCOPE("checkLevelUp");
+    if (player.xp >= player.xpToNextLevel) {
+        player.level++;
+        player.xp -= player.xpToNextLevel; // Reset XP for the new level
+        player.xpToNextLevel = player.xpToNextLevel * 2; // Increase XP required for the next level
+        player.maxHp += 5; // Increase max HP
+        player.hp = player.maxHp; // Fully heal on level up
+        player.maxMana += 2; // Increase max Mana
+        player.mana = player.maxMana; // Fully restore mana
+        player.intelligence++; // Increase intelligence
+        pendingSounds |= SOUND_LEVELUP;
+        
+        gameState = STATE_LEVELUP;
+    }
+}
+
+// Mark tiles within the player's sight as explored
+void updateVisibility() {
+    TRACE_SCOPE("updateVisibility");
+    int startX = player.x - player.visibilityRadius;
+    int endX   = player.x + player.visibilityRadius;
+    int startY = player.y - player.visibilityRadius;
+    int endY   = player.y + player.visibilityRadius;
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX >= MAP_WIDTH) endX = MAP_WIDTH - 1;
+    if (endY >= MAP_HEIGHT) endY = MAP_HEIGHT - 1;
+
+    int explored = 0;
+    for (int y = startY; y <= endY; y++) {
+        for (int x = startX; x <= endX; x++) {
+            if (!visibility[y][x] && getDistance(player.x, player.y, x, y) <= player.visibilityRadius) {
+                visibility[y][x] = 1;
+                explored = 1;
+            }
+        }
+    }
+    if (explored) mapVersion++;
+}
+
+// FNV-1a over the state that decides how the game plays out, chained
+// onto `hash` so a checksum covers every earlier one as well
+static uint64_t hashInts(uint64_t hash, const int* values, int count) {
+    for (int i = 0; i < count; i++) {
+        uint32_t value = (uint32_t)values[i];
+        for (int b = 0; b < 4; b++) {
+            hash = (hash ^ ((value >> (b * 8)) & 0xFF)) * 0x100000001B3ULL;
+        }
+    }
+    return hash;
+}
+
+uint64_t hashGameState(uint64_t hash) {
+    if (hash == 0) hash = 0xCBF29CE484222325ULL;
+    const int playerValues[] = {
+        player.x, player.y, player.hp, player.maxHp, player.mana, player.maxMana, player.intelligence,
+        player.score, player.healthPotions, player.foodInInventory, player.level, player.xp,
+        player.xpToNextLevel, player.hunger, player.visibilityRadius, player.isStarving,
+        dungeonLevel, turnCounter, restCounter, (int)(rngState >> 32), (int)rngState
+    };
+    hash = hashInts(hash, playerValues, sizeof(playerValues) / sizeof(playerValues[0]));
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        const int monsterValues[] = {
+            monsters[i].active, monsters[i].x, monsters[i].y, monsters[i].hp, monsters[i].symbol
+        };
+        hash = hashInts(hash, monsterValues, 5);
+    }
+    const unsigned char* tiles = (const unsigned char*)map;
+    for (int i = 0; i < MAP_WIDTH * MAP_HEIGHT; i++) {
+        hash = (hash ^ tiles[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+// Function to display a message to the player
+void showMessage(const char* message) {
+    // Messages from the same turn pile up; the first of a new one replaces them
+    if (!messageLog.turnHasMessages) {
+        messageLog.firstRecent = messageLog.count;
+        messageLog.turnHasMessages = 1;
+    }
+    snprintf(messageLog.lines[messageLog.count % MESSAGE_LOG_SIZE], MESSAGE_LENGTH, "%s", message);
+    messageLog.count++;
+    messageLog.recentTurnsLeft = 2; // Stays for 1 turn after the current one
+}
+
+const char* messageLogLine(uint32_t number) {
+    if (number >= messageLog.count || messageLog.count - number > MESSAGE_LOG_SIZE) {
+        return NULL;
+    }
+    return messageLog.lines[number % MESSAGE_LOG_SIZE];
+}
+
+const char* latestMessage() {
+    if (messageLog.firstRecent >= messageLog.count) return "";
+    return messageLog.lines[(messageLog.count - 1) % MESSAGE_LOG_SIZE];
+}
+
+// Simple Manhattan distance calculation
+int getDistance(int x1, int y1, int x2, int y2) {
+    return abs(x1 - x2) + abs(y1 - y2);
+}
+
+// Check if a tile is occupied by a monster
+int isOccupiedByMonster(int x, int y) {
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        if (monsters[i].active && monsters[i].x == x && monsters[i].y == y) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Check if a tile is walkable (not a wall)
+int isTileWalkable(int x, int y) {
+    if (x >= 0 && x < MAP_WIDTH && y >= 0 && y < MAP_HEIGHT && map[y][x] != '#') {
+        return 1;
+    }
+    return 0;
+}
+
+int nextEffectFrame() {
+    return numEffects > 0 ? effects[numEffects - 1].frame + 1 : 0;
+}
+
+// Drops the effect if the queue is full; the turn is the same without it
+void queueEffect(int frame, int x, int y, char symbol) {
+    if (numEffects < MAX_EFFECTS) {
+        effects[numEffects].frame = frame;
+        effects[numEffects].x = x;
+        effects[numEffects].y = y;
+        effects[numEffects].symbol = symbol;
+        numEffects++;
+    }
+}
@@ -1,17 +1,33 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <stdint.h>
+
 #define TILE_SIZE 24
 #define MAP_WIDTH 160
 #define MAP_HEIGHT 50
 #define MAX_MONSTERS 20
 #define MAX_ROOMS 20
 #define MONSTER_DETECTION_RANGE 8
+#define FINAL_DUNGEON_LEVEL 5
+#define MIN_REGION_SIZE 12 // Smaller disconnected pockets are filled in
+#define GAME_RAND_MAX 0x7FFFFFFF
 
+// Defaults of the balance settings below
 #define HUNGER_STARVING 200
 #define PASSIVE_REGEN_INTERVAL 5
 #define HUNGER_TURN_THRESHOLD 20
 #define REST_TURNS_REQUIRED 5
+#define REST_HUNGER 5 // Extra hunger per turn of rest
+
+#define MAX_EFFECTS (MAP_WIDTH + MAX_MONSTERS * MONSTER_DETECTION_RANGE) // A missile across the map and a volley of bolts
+#define SOUND_BEEP 1          // Bits of pendingSounds: starving
+#define SOUND_HIT 2           // The player took damage from a monster
+#define SOUND_MISSILE 4       // A magic missile was cast
+#define SOUND_PICKUP 8
+#define SOUND_LEVELUP 16
+#define MESSAGE_LOG_SIZE 32   // Messages kept for scrollback
+#define MESSAGE_LENGTH 128
 
 // Player attributes
 typedef struct {
@@ -52,6 +68,30 @@ typedef struct {
     int width, height;
 } Room;
 
+// A tile grid plus the rooms carved into it. The game level is a
+// DungeonGrid over `map`/`rooms`; tools and benchmarks can point one at
+// larger buffers of their own.
+typedef struct {
+    char* tiles;  // width * height tiles, row-major
+    int width, height;
+    Room* rooms;
+    int numRooms;
+    int maxRooms;
+} DungeonGrid;
+
+// Room layout generators
+typedef enum {
+    GEN_RANDOM_ROOMS, // Random rectangles, colliding ones are dropped
+    GEN_BSP,          // Binary space partition, one room per leaf
+    GEN_CAVE          // Cellular automaton caves, no rooms
+} DungeonGenerator;
+
+// Corridor layouts
+typedef enum {
+    CORRIDORS_SEQUENTIAL, // Room i to room i+1 in creation order
+    CORRIDORS_MST         // Minimum spanning tree over room centers, plus a few loops
+} CorridorStyle;
+
 // Game states
 typedef enum {
     STATE_PLAYING,
@@ -61,4 +101,140 @@ typedef enum {
     STATE_LEVELUP
 } GameState;
 
+// Things the player can do on their turn; handlePlayingInput turns keys
+// into these so they can be recorded and replayed
+typedef enum {
+    ACTION_NONE,
+    ACTION_MOVE,       // dx, dy: one step, attacking a monster in the way
+    ACTION_REST,
+    ACTION_HEAL,
+    ACTION_MISSILE,    // dx, dy: direction of the missile
+    ACTION_PHASE_DOOR,
+    ACTION_EAT,
+    ACTION_POTION
+} ActionType;
+
+typedef struct {
+    ActionType type;
+    int dx, dy;
+} Action;
+
+// A multi-turn command: rest until healed, run in a direction, or
+// travel along a path (travel.h). The frontend plays the action turn
+// after turn without drawing, and asks continueRepeat after each turn
+// whether to go on.
+#define MAX_REPEAT_TURNS 500
+
+typedef struct {
+    Action action; // ACTION_REST, or ACTION_MOVE to run
+    int turns;     // Turns played so far
+    int hp;        // HP after the last turn, to notice damage
+    int level;
+    int items;     // Potions and food carried, to notice a pickup
+    int sides;     // Running: which tiles beside the player were open
+    int followPath; // Travelling: the direction changes from step to step
+} RepeatCommand;
+
+// A symbol in one frame of an animation (a missile in flight) for the
+// frontend to play after the turn; the game logic itself never draws.
+// Effects are queued in frame order, and those sharing a frame are drawn
+// together.
+typedef struct {
+    int frame;
+    int x, y;
+    char symbol;
+} Effect;
+
+// The last MESSAGE_LOG_SIZE messages, the oldest overwritten first.
+// Message number n is in lines[n % MESSAGE_LOG_SIZE]. Messages from
+// firstRecent on arrived during the latest turn and are still on screen;
+// they leave it together once recentTurnsLeft runs out.
+typedef struct {
+    char lines[MESSAGE_LOG_SIZE][MESSAGE_LENGTH];
+    uint32_t count; // Messages shown so far
+    uint32_t firstRecent;
+    int32_t turnHasMessages; // The next message joins firstRecent's rather than replacing them
+    int32_t recentTurnsLeft; // Turns ended before the recent messages leave the screen
+} MessageLog;
+
+// Game state (game.c). Each thread has its own copy, so tools can run
+// independent games side by side; the game itself only uses one thread.
+extern _Thread_local Player player;
+extern _Thread_local Monster monsters[MAX_MONSTERS];
+extern _Thread_local Room rooms[MAX_ROOMS];
+extern _Thread_local int numRooms;
+extern _Thread_local char map[MAP_HEIGHT][MAP_WIDTH];
+extern _Thread_local int visibility[MAP_HEIGHT][MAP_WIDTH];
+extern _Thread_local int regionLabels[MAP_HEIGHT][MAP_WIDTH];
+extern _Thread_local int playerRegion;
+extern _Thread_local int dungeonLevel;
+extern _Thread_local uint64_t rngState;
+extern _Thread_local MessageLog messageLog;
+extern _Thread_local int turnCounter;
+extern _Thread_local int restCounter;
+extern _Thread_local GameState gameState;
+extern _Thread_local Effect effects[MAX_EFFECTS];
+extern _Thread_local int numEffects;
+extern _Thread_local unsigned int pendingSounds; // SOUND_ bits to play, cleared by the frontend
+extern _Thread_local unsigned int mapVersion; // Changes whenever map or visibility does, for caches built from them
+
+// Shared configuration
+extern Monster monsterTemplates[];
+extern Monster finalBossTemplate;
+extern const int numMonsterTypes;
+extern DungeonGenerator levelGenerators[FINAL_DUNGEON_LEVEL + 1];
+extern CorridorStyle corridorStyle;
+extern int hungerStarving;       // Hunger at which the player starts losing HP
+extern int passiveRegenInterval; // Turns per point of HP and mana regenerated
+extern int restTurnsRequired;    // Turns of rest per extra point of HP and mana
+extern int restHunger;
+
+// Random numbers (game.c)
+void seedGameRand(uint64_t seed);
+int gameRand(); // 0..GAME_RAND_MAX, use like rand()
+
+// Game rules (game.c). None of this touches SDL, so the same code runs
+// in the game, in replays and headless.
+void newGame();
+int playTurn(Action action); // Returns 1 if a turn passed
+int startRepeat(RepeatCommand* command, Action action, int followPath); // Returns 0 if there is nothing to repeat
+int continueRepeat(RepeatCommand* command, int turnPassed); // Returns 0 once the command should stop
+int performAction(Action action);
+int movePlayer(int newX, int newY);
+void endTurn();
+void checkGameEnd();
+void moveMonsters();
+void fightMonster(int monsterIndex);
+void rest();
+void castHealSpell();
+void castMagicMissile(int dx, int dy);
+void castPhaseDoorSpell();
+void useHealthPotion();
+void eatFood();
+void checkLevelUp();
+void updateVisibility();
+uint64_t hashGameState(uint64_t hash); // Rolling checksum of player, monsters and map
+void showMessage(const char* message);
+const char* messageLogLine(uint32_t number); // NULL if it was never shown or has been overwritten
+const char* latestMessage(); // The newest message while it is on screen, "" after
+int getDistance(int x1, int y1, int x2, int y2);
+int isOccupiedByMonster(int x, int y);
+int isTileWalkable(int x, int y);
+int nextEffectFrame(); // The first frame after those already queued
+void queueEffect(int frame, int x, int y, char symbol);
+
+// Dungeon generation (dungeon.c)
+void generateDungeon();
+void createRoom(DungeonGrid* grid, int x, int y, int width, int height);
+void placeRoomsRandom(DungeonGrid* grid, int attempts);
+void placeRoomsBSP(DungeonGrid* grid);
+void connectRooms(DungeonGrid* grid);
+void connectRoomsMST(DungeonGrid* grid);
+void generateCave(DungeonGrid* grid, int smoothingPasses);
+int labelRegions(const DungeonGrid* grid, int* labels);
+int repairConnectivity(DungeonGrid* grid, int* labels, int x, int y);
+void placeMonsters();
+void placePotions();
+void placeFood();
+
 #endif // GAME_H
@@ -0,0 +1,125 @@
+// Headless runner: plays a recording through the game rules with no
+// window, sound or delays, and checks the state checksums stored in it.
+// A refactor of the turn logic that changes behaviour shows up as the
+// first action whose checksum no longer matches. With -bot it lets the
+// bot play whole games instead, for load testing.
+//
+// Usage: headless <replay-file>
+//        headless -bot [-s first-seed] [-n games] [-t max-turns] [-o recording] [-v]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bot.h"
+#include "replay.h"
+
+#define BOT_MAX_TURNS 100000 // Default cap, in case the bot gets stuck
+
+static double now() {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Play `count` bot games from consecutive seeds and summarize them.
+// With a recording path, each game is recorded there, so the file ends
+// up holding the last one.
+static int runBotGames(long long firstSeed, long count, long maxTurns, const char* recordPath, int verbose) {
+    long wins = 0;
+    long long totalTurns = 0;
+    long long totalDepth = 0;
+
+    double start = now();
+    for (long i = 0; i < count; i++) {
+        seedGameRand((uint64_t)(firstSeed + i));
+        newGame();
+        if (recordPath != NULL && startRecording(recordPath) != 0) return 1;
+        long turns = playBotGame(maxTurns);
+        stopRecording();
+
+        wins += gameState == STATE_WIN;
+        totalTurns += turns;
+        totalDepth += dungeonLevel;
+        if (verbose) {
+            printf("seed %lld: %s on level %d after %ld turns, score %d%s%s\n", firstSeed + i,
+                   gameState == STATE_WIN ? "won" : gameState == STATE_GAMEOVER ? "died" : "stopped",
+                   dungeonLevel, turns, player.score,
+                   gameState == STATE_GAMEOVER ? ", killed by " : "",
+                   gameState == STATE_GAMEOVER ? player.causeOfDeath : "");
+        }
+    }
+    double elapsed = now() - start;
+
+    printf("%ld games in %.2f s (%.0f games/min): %ld won, %.1f turns and depth %.2f on average\n",
+           count, elapsed, elapsed > 0 ? count * 60.0 / elapsed : 0.0, wins,
+           count > 0 ? (double)totalTurns / count : 0.0, count > 0 ? (double)totalDepth / count : 0.0);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    Replay replay;
+    Action action;
+    long turns = 0;
+
+    if (argc >= 2 && strcmp(argv[1], "-bot") == 0) {
+        long long firstSeed = 1;
+        long count = 1000;
+        long maxTurns = BOT_MAX_TURNS;
+        const char* recordPath = NULL;
+        int verbose = 0;
+        for (int i = 2; i < argc; i++) {
+            if (strcmp(argv[i], "-v") == 0) {
+                verbose = 1;
+            } else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) {
+                firstSeed = atoll(argv[++i]);
+            } else if (i + 1 < argc && strcmp(argv[i], "-n") == 0) {
+                count = atol(argv[++i]);
+            } else if (i + 1 < argc && strcmp(argv[i], "-t") == 0) {
+                maxTurns = atol(argv[++i]);
+            } else if (i + 1 < argc && strcmp(argv[i], "-o") == 0) {
+                recordPath = argv[++i];
+            } else {
+                printf("Usage: %s -bot [-s first-seed] [-n games] [-t max-turns] [-o recording] [-v]\n", argv[0]);
+                return 1;
+            }
+        }
+        return runBotGames(firstSeed, count, maxTurns, recordPath, verbose);
+    }
+
+    if (argc != 2) {
+        printf("Usage: %s <replay-file>\n", argv[0]);
+        printf("       %s -bot [-s first-seed] [-n games] [-t max-turns] [-o recording] [-v]\n", argv[0]);
+        return 1;
+    }
+    if (openReplay(argv[1], &replay) != 0) {
+        return 1;
+    }
+
+    double start = now();
+    while (gameState == STATE_PLAYING && nextReplayAction(&replay, &action)) {
+        turns += playTurn(action);
+        pendingSounds = 0;
+        if (gameState == STATE_LEVELUP) {
+            gameState = STATE_PLAYING; // Nothing to show
+        }
+        if (verifyReplayChecksum(&replay) != 0) {
+            break;
+        }
+    }
+    double elapsed = now() - start;
+
+    printf("Replayed %ld actions (%ld turns) in %.3f s (%.0f turns/s), %ld checksums verified\n",
+           replay.actionsRead, turns, elapsed, elapsed > 0 ? turns / elapsed : 0.0, replay.checksumsVerified);
+    int result = 0;
+    if (replay.mismatchAction >= 0) {
+        printf("Diverged at action %ld: recorded checksum %016llx, replayed %016llx\n",
+               replay.mismatchAction, (unsigned long long)replay.recordedChecksum,
+               (unsigned long long)replay.checksum);
+        result = 1;
+    } else if (nextReplayAction(&replay, &action)) {
+        printf("Diverged: the game ended with actions left in the recording\n");
+        result = 1;
+    }
+    closeReplay(&replay);
+    return result;
+}
@@ -0,0 +1,121 @@
+#include <string.h>
+#include "lz.h"
+
+#define LZ_MIN_MATCH 4
+#define LZ_MAX_OFFSET 65535
+#define LZ_HASH_BITS 12
+
+static unsigned int hashFour(const unsigned char* p) {
+    unsigned int v = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+// Lengths of 15 and up continue in extra bytes of 255 until a smaller one
+static unsigned char* writeLength(unsigned char* out, size_t length) {
+    while (length >= 255) {
+        *out++ = 255;
+        length -= 255;
+    }
+    *out++ = (unsigned char)length;
+    return out;
+}
+
+size_t lzCompressBound(size_t size) {
+    return size + size / 255 + 16;
+}
+
+size_t lzCompress(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity) {
+    size_t table[1 << LZ_HASH_BITS];
+    const unsigned char* end = src + size;
+    const unsigned char* literals = src;
+    const unsigned char* p = src;
+    unsigned char* out = dst;
+
+    if (capacity < lzCompressBound(size)) return 0;
+    memset(table, 0, sizeof(table));
+
+    // Keep the last few bytes as literals so matches never read past the end
+    while (size >= LZ_MIN_MATCH + 1 && p + LZ_MIN_MATCH < end) {
+        unsigned int h = hashFour(p);
+        const unsigned char* candidate = src + table[h];
+        table[h] = (size_t)(p - src);
+        if (candidate >= p || p - candidate > LZ_MAX_OFFSET || memcmp(candidate, p, LZ_MIN_MATCH) != 0) {
+            p++;
+            continue;
+        }
+
+        size_t matchLength = LZ_MIN_MATCH;
+        while (p + matchLength < end && candidate[matchLength] == p[matchLength]) {
+            matchLength++;
+        }
+
+        size_t literalCount = (size_t)(p - literals);
+        size_t extraMatch = matchLength - LZ_MIN_MATCH;
+        unsigned char* token = out++;
+        *token = (unsigned char)(((literalCount < 15 ? literalCount : 15) << 4) | (extraMatch < 15 ? extraMatch : 15));
+        if (literalCount >= 15) out = writeLength(out, literalCount - 15);
+        memcpy(out, literals, literalCount);
+        out += literalCount;
+        size_t offset = (size_t)(p - candidate);
+        *out++ = (unsigned char)(offset & 0xFF);
+        *out++ = (unsigned char)(offset >> 8);
+        if (extraMatch >= 15) out = writeLength(out, extraMatch - 15);
+
+        p += matchLength;
+        literals = p;
+    }
+
+    // Final sequence: literals only
+    size_t literalCount = (size_t)(end - literals);
+    *out++ = (unsigned char)((literalCount < 15 ? literalCount : 15) << 4);
+    if (literalCount >= 15) out = writeLength(out, literalCount - 15);
+    memcpy(out, literals, literalCount);
+    out += literalCount;
+    return (size_t)(out - dst);
+}
+
+long lzDecompress(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity) {
+    const unsigned char* in = src;
+    const unsigned char* inEnd = src + size;
+    unsigned char* out = dst;
+    unsigned char* outEnd = dst + capacity;
+
+    while (in < inEnd) {
+        unsigned char token = *in++;
+        size_t literalCount = token >> 4;
+        if (literalCount == 15) {
+            unsigned char extra;
+            do {
+                if (in >= inEnd) return -1;
+                extra = *in++;
+                literalCount += extra;
+            } while (extra == 255);
+        }
+        if ((size_t)(inEnd - in) < literalCount || (size_t)(outEnd - out) < literalCount) return -1;
+        memcpy(out, in, literalCount);
+        in += literalCount;
+        out += literalCount;
+        if (in == inEnd) break; // Last sequence has no match
+
+        if (inEnd - in < 2) return -1;
+        size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        size_t matchLength = (token & 15) + LZ_MIN_MATCH;
+        if ((token & 15) == 15) {
+            unsigned char extra;
+            do {
+                if (in >= inEnd) return -1;
+                extra = *in++;
+                matchLength += extra;
+            } while (extra == 255);
+        }
+        if (offset == 0 || offset > (size_t)(out - dst) || (size_t)(outEnd - out) < matchLength) return -1;
+        // Byte by byte: matches may overlap their own output
+        const unsigned char* match = out - offset;
+        for (size_t i = 0; i < matchLength; i++) {
+            out[i] = match[i];
+        }
+        out += matchLength;
+    }
+    return (long)(out - dst);
+}
@@ -0,0 +1,21 @@
+#ifndef LZ_H
+#define LZ_H
+
+#include <stddef.h>
+
+// Small LZ77 byte codec (LZ4-style block format): sequences of a token
+// byte (literal count, match length), the literals and a 16-bit match
+// offset. Fast to decode and good on long runs of walls and zeros.
+
+// Worst-case compressed size of `size` bytes
+size_t lzCompressBound(size_t size);
+
+// Compress `size` bytes into `dst`; returns the compressed size, or 0 if
+// `capacity` is too small.
+size_t lzCompress(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity);
+
+// Decompress into `dst`; returns the decompressed size, or -1 if the
+// input is malformed or doesn't fit.
+long lzDecompress(const unsigned char* src, size_t size, unsigned char* dst, size_t capacity);
+
+#endif // LZ_H
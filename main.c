@@ -1,49 +1,41 @@
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_mixer.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
 #include <math.h>
-#include "font.h"
+#include "assets.h"
 #include "game.h"
+#include "perf.h"
+#include "replay.h"
+#include "save.h"
+#include "synth.h"
+#include "text.h"
+#include "trace.h"
+#include "travel.h"
 
 // Screen dimensions (will be set at runtime)
 int SCREEN_WIDTH;
 int SCREEN_HEIGHT;
 
-// Monster templates with scoring
-Monster monsterTemplates[] = {
-    {0, 0, 5, 'g', "Goblin", 1, 2, 10, 0},
-    {0, 0, 15, 'O', "Ogre", 1, 1, 50, 0},
-    {0, 0, 10, 'o', "Orc", 1, 1, 20, 0},
-    {0, 0, 8, 's', "Snake", 1, 3, 15, 0},
-    {0, 0, 25, 'D', "Dragon", 1, 1, 100, 0},
-    {0, 0, 12, 'E', "Poisonous Eye", 1, 2, 40, 1}
-};
-
-Monster finalBossTemplate = {0, 0, 100, 'L', "Lich Lord", 1, 1, 500, 1};
-
-#define NUM_MONSTER_TYPES (sizeof(monsterTemplates) / sizeof(Monster))
-
-
-// Game state variables
-Player player;
-Monster monsters[MAX_MONSTERS];
-Room rooms[MAX_ROOMS];
-int numRooms = 0;
-char map[MAP_HEIGHT][MAP_WIDTH];
-char messageBuffer[256];
-int messageTimer = 0; // Timer to clear the message log
-int turnCounter = 0; // New turn counter for passive regeneration
-int restCounter = 0; // Counter for resting
-GameState gameState = STATE_PLAYING;
+// Frontend state variables
 int isAwaitingSpellDirection = 0; // New flag for magic missile
-int dungeonLevel = 1;
-
-// Explored tiles: 1 if the player has seen the tile
-int visibility[MAP_HEIGHT][MAP_WIDTH];
+int turnsSinceAutosave = 0;
+
+// Replay playback
+#define REPLAY_TURN_DELAY 100 // Milliseconds between turns at normal speed
+#define REPLAY_FAST_BATCH 1000 // Turns per frame when fast-forwarding
+Replay replay;
+int replayMode = 0;  // Watching a recording: no saving or recording
+int replaying = 0;   // Recorded actions remain
+int fastForward = 0; // Skip rendering while replaying
+
+// Message log: the latest turn's messages, or a page of history while
+// scrolled back with Page Up
+#define MESSAGE_BURST_LINES 5
+#define MESSAGE_HISTORY_LINES 12
+int messageHistoryScroll = -1; // Lines scrolled back, -1 while the history is closed
 
 // Camera/Viewport position
 int cameraX = 0;
@@ -52,102 +44,141 @@ int cameraY = 0;
 // SDL2 variables
 SDL_Window* window = NULL;
 SDL_Renderer* renderer = NULL;
-TTF_Font* font = NULL;
 SDL_Color textColor = {255, 255, 255, 255}; // White color
 
-// Sound variables
-Mix_Chunk* beepSound = NULL;
-unsigned char beep_raw_data[] = {
-    // A simple 440 Hz square wave for 0.5 seconds
-    // This is just a placeholder, you can replace it with any raw audio data
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// Text rendered once and drawn from its texture until it changes
+typedef struct {
+    char text[256];
+    SDL_Color color;
+    SDL_Texture* texture; // NULL for empty text
+    int width, height;
+    int valid;
+} CachedText;
+
+CachedText messageLines[MESSAGE_LOG_SIZE]; // One per slot of messageLog.lines
+
+// The stats line at the top, one widget per field. A widget formats and
+// renders its text only when the values behind it change.
+typedef enum {
+    HUD_HP, HUD_MANA, HUD_INTELLIGENCE, HUD_SCORE, HUD_POTIONS, HUD_FOOD,
+    HUD_LEVEL, HUD_XP, HUD_DUNGEON_LEVEL, HUD_WIDGETS
+} HudField;
+
+typedef struct {
+    int values[2]; // As last formatted
+    int valid;
+    char label[48];
+    CachedText text;
+} HudWidget;
+
+const char* hudFormats[HUD_WIDGETS] = {
+    "HP: %d/%d | ", "Mana: %d/%d | ", "Int: %d | ", "Score: %d | ", "Potions: %d | ",
+    "Food: %d | ", "Lvl: %d | ", "XP: %d/%d | ", "Dlvl: %d"
 };
-unsigned int beep_raw_data_len = 128;
+HudWidget hudWidgets[HUD_WIDGETS];
+
+// Sound effects, synthesized at startup into one buffer (synth.h).
+// Chunks play straight from it, so playing a sound never allocates.
+Mix_Chunk* soundChunks[16]; // One per synthPatches entry
+Sint16* soundBank = NULL;
 
 
 // Function prototypes
 void initSDL();
+void initSounds();
 void closeSDL();
-void generateDungeon();
-void createRoom(int x, int y, int width, int height);
-void connectRooms();
-void placeMonsters();
 int handlePlayingInput(SDL_Event* e); // Returns 1 if a turn passed, 0 otherwise
+int playerAction(Action action);
+int playerRepeat(Action action);
+int playerTravel(TravelKind kind, int x, int y);
+void presentTurn(int previousLevel, int turnsPlayed);
+void animateEffects();
+void autosave();
 int handleHelpInput(SDL_Event* e);
-void moveMonsters();
-void fightMonster(int monsterIndex);
-void rest();
-void castHealSpell();
-void castMagicMissile(int dx, int dy);
-void castPhaseDoorSpell();
-void useHealthPotion();
 void renderGame();
 void renderGameOverScreen();
 void renderHelpScreen();
 void renderWinScreen();
 void renderLevelUpScreen();
 void drawText(const char* text, int x, int y, SDL_Color color);
-void showMessage(const char* message);
-int getDistance(int x1, int y1, int x2, int y2);
-int isOccupiedByMonster(int x, int y);
-int isTileWalkable(int x, int y);
-void checkLevelUp();
-void updateVisibility();
-void placePotions();
-void placeFood();
-void eatFood();
+int drawCachedText(CachedText* cached, const char* text, int x, int y, SDL_Color color);
+void freeCachedText(CachedText* cached);
+int renderHud(int x, int y); // Returns the x it ended at
+void renderMessageLog();
+void scrollMessageHistory(int lines);
 
 int main(int argc, char* args[]) {
+    const char* replayPath = NULL;
+    int resume = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(args[i], "--resume") == 0) {
+            resume = 1;
+        } else if (strcmp(args[i], "--fast") == 0) {
+            fastForward = 1;
+        } else if (i + 1 < argc && strcmp(args[i], "--replay") == 0) {
+            replayPath = args[++i];
+        }
+    }
+
     initSDL();
-    srand(time(NULL));
-
-    // Initialize player
-    player.hp = 20;
-    player.maxHp = 20;
-    player.mana = 10;
-    player.maxMana = 10;
-    player.intelligence = 5;
-    player.score = 0;
-    player.healthPotions = 0;
-    player.foodInInventory = 10; // Start with 10 food items
-    player.level = 1;
-    player.xp = 0;
-    player.xpToNextLevel = 150; // Increased XP threshold
-    player.hunger = 0;
-    player.visibilityRadius = 8; // Default visibility radius
-    player.causeOfDeath[0] = '\0';
-    player.isStarving = 0;
-    player.turnsToHunger = HUNGER_TURN_THRESHOLD;
-
-    // Generate the initial dungeon and place monsters
-    generateDungeon();
-    placeMonsters();
+    seedGameRand(time(NULL));
+    TRACE_THREAD("game");
+
+    // Play back a recording, resume the game saved on quit, or start a
+    // new game
+    int resumed = 0;
+    if (replayPath != NULL) {
+        if (openReplay(replayPath, &replay) != 0) {
+            closeSDL();
+            return 1;
+        }
+        replayMode = 1;
+        replaying = 1;
+        resumed = 1;
+    } else if (resume) {
+        resumed = loadGame(SAVE_FILE) == 0;
+    }
+    if (!resumed) {
+        newGame();
+    }
     updateVisibility();
+    if (!replayMode) {
+        startAutosave(SAVE_FILE);
+        startRecording(REPLAY_FILE);
+    }
 
     int running = 1;
     SDL_Event e;
-    int playerTurnPassed = 0;
+    Uint32 lastReplayTurn = 0;
 
     while (running) {
+        TRACE_SCOPE("frame");
+        beginPerfFrame();
         while (SDL_PollEvent(&e) != 0) {
+            TRACE_SCOPE("input");
             if (e.type == SDL_QUIT) {
                 running = 0;
+            } else if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F3) {
+                perfOverlayVisible = !perfOverlayVisible;
+            } else if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_F12) {
+                // Dump the trace so far; only does anything in TRACE=1 builds
+                if (TRACE_DUMP(TRACE_FILE) == 0) {
+                    showMessage("Trace written to " TRACE_FILE ".");
+                }
             } else if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE) {
                 if (gameState == STATE_HELP) {
                     gameState = STATE_PLAYING;
                 } else if (gameState == STATE_PLAYING) {
                     running = 0;
                 }
+            } else if (replaying) {
+                // The recording drives the game; space toggles fast-forward
+                if (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_SPACE) {
+                    fastForward = !fastForward;
+                }
             } else {
                 if (gameState == STATE_PLAYING) {
-                    playerTurnPassed = handlePlayingInput(&e);
+                    handlePlayingInput(&e); // Plays the turn, if the key used one
                 } else if (gameState == STATE_HELP) {
                     // Handled in the main loop for now, but good to have a dedicated function
                 } else if (gameState == STATE_LEVELUP) {
@@ -157,71 +188,41 @@ int main(int argc, char* args[]) {
                 }
             }
         }
-        
-        // Only update game state once per player turn
-        if (playerTurnPassed) {
-            if (gameState == STATE_PLAYING) {
-                moveMonsters();
-                // Decrement the message timer
-                if (messageTimer > 0) {
-                    messageTimer--;
-                    if (messageTimer == 0) {
-                        memset(messageBuffer, 0, sizeof(messageBuffer));
-                    }
-                }
-                
-                // Hunger mechanic
-                player.hunger++;
-                if (player.hunger >= HUNGER_STARVING) {
-                    player.hp--;
-                    if (player.isStarving == 0) {
-                        Mix_PlayChannel(-1, beepSound, 0); // Play beep once
-                        showMessage("You are starving!");
-                        player.isStarving = 1;
-                    }
-                } else {
-                    player.isStarving = 0; // Reset starving flag
-                }
 
-                // Passive regeneration
-                turnCounter++;
-                if (turnCounter >= PASSIVE_REGEN_INTERVAL) {
-                    if (player.hp < player.maxHp) {
-                        player.hp++;
-                    }
-                    if (player.mana < player.maxMana) {
-                        player.mana++;
-                    }
-                    turnCounter = 0;
-                }
-                
-                checkLevelUp(); // Check for level up after every turn
-                updateVisibility(); // Update visibility after every turn
-            }
-            playerTurnPassed = 0; // Reset flag
-        }
-        
-        // Check for game over or win condition
-        if (player.hp <= 0 && gameState != STATE_GAMEOVER) {
-            gameState = STATE_GAMEOVER;
-            strncpy(player.causeOfDeath, "starvation", sizeof(player.causeOfDeath) - 1);
-            player.causeOfDeath[sizeof(player.causeOfDeath) - 1] = '\0';
-        }
-        
-        // Win condition: dungeon level 5 and the boss is defeated
-        if (dungeonLevel >= 5) {
-            int bossIsAlive = 0;
-            for (int i = 0; i < MAX_MONSTERS; i++) {
-                if (monsters[i].active && strcmp(monsters[i].name, "Lich Lord") == 0) {
-                    bossIsAlive = 1;
+        // Feed recorded actions through the same turn logic as the keyboard:
+        // one per REPLAY_TURN_DELAY, or a batch per frame when fast-forwarding
+        if (replaying && gameState == STATE_PLAYING &&
+            (fastForward || SDL_GetTicks() - lastReplayTurn >= REPLAY_TURN_DELAY)) {
+            int turns = fastForward ? REPLAY_FAST_BATCH : 1;
+            Action action;
+            lastReplayTurn = SDL_GetTicks();
+            while (turns-- > 0) {
+                if (!nextReplayAction(&replay, &action)) {
+                    replaying = 0;
+                    fastForward = 0;
+                    showMessage("Replay finished.");
                     break;
                 }
-            }
-            if (!bossIsAlive && gameState != STATE_WIN) {
-                gameState = STATE_WIN;
+                int level = dungeonLevel;
+                Uint64 turnStart = SDL_GetPerformanceCounter();
+                int turnPassed = playTurn(action);
+                addTurnSample(SDL_GetPerformanceCounter() - turnStart);
+                if (verifyReplayChecksum(&replay) != 0) {
+                    char tempBuffer[256];
+                    snprintf(tempBuffer, sizeof(tempBuffer), "Replay diverged from the recording at action %ld!",
+                             replay.mismatchAction);
+                    showMessage(tempBuffer);
+                }
+                presentTurn(level, turnPassed);
+                if (fastForward && gameState == STATE_LEVELUP) {
+                    gameState = STATE_PLAYING; // Skip the level up pause
+                }
+                if (gameState != STATE_PLAYING) break;
             }
         }
 
+        checkGameEnd();
+
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
 
@@ -248,14 +249,32 @@ int main(int argc, char* args[]) {
                 running = 0;
                 break;
         }
-        
-        SDL_RenderPresent(renderer);
+
+        {
+            TRACE_SCOPE("SDL_RenderPresent");
+            SDL_RenderPresent(renderer);
+        }
     }
 
+    stopRecording();
+    stopAutosave();
+    if (!replayMode && gameState != STATE_GAMEOVER && gameState != STATE_WIN) {
+        saveGame(SAVE_FILE); // Quit mid-game: keep a save to --resume from
+    }
+    closeReplay(&replay);
+    TRACE_DUMP(TRACE_FILE);
     closeSDL();
     return 0;
 }
 
+// Queue a background save, unless we are watching a replay
+void autosave() {
+    turnsSinceAutosave = 0;
+    if (!replayMode) {
+        requestAutosave();
+    }
+}
+
 // Initialize SDL2, Window, Renderer, and Font
 void initSDL() {
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
@@ -283,254 +302,87 @@ void initSDL() {
         printf("Renderer could not be created! SDL_Error: %s\n", SDL_GetError());
         exit(1);
     }
-    if (TTF_Init() == -1) {
-        printf("SDL_ttf could not initialize! TTF_Error: %s\n", TTF_GetError());
-        exit(1);
-    }
-
-    // Load font from embedded data
-    SDL_RWops* rw = SDL_RWFromConstMem(DejaVuSansMono_ttf, sizeof(DejaVuSansMono_ttf));
-    font = TTF_OpenFontRW(rw, 1, TILE_SIZE);
-    
-    if (font == NULL) {
-        printf("Failed to load font from memory! TTF_Error: %s\n", TTF_GetError());
+    if (initText() != 0) {
         exit(1);
     }
+    initPerfOverlay(renderer); // The game runs without it if this fails
 
     // Initialize SDL_mixer for sound
     if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
         printf("SDL_mixer could not initialize! Mix_Error: %s\n", Mix_GetError());
     }
 
-    // Load sound from embedded data
-    SDL_RWops* rwBeep = SDL_RWFromConstMem(beep_raw_data, beep_raw_data_len);
-    beepSound = Mix_LoadWAV_RW(rwBeep, 1);
-    if (beepSound == NULL) {
-        printf("Failed to load beep sound! Mix_Error: %s\n", Mix_GetError());
-    }
-
-    // Initialize message buffer
-    memset(messageBuffer, 0, sizeof(messageBuffer));
-}
-
-// Clean up SDL resources
-void closeSDL() {
-    Mix_FreeChunk(beepSound);
-    beepSound = NULL;
-    Mix_Quit();
-    TTF_CloseFont(font);
-    font = NULL;
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    window = NULL;
-    renderer = NULL;
-    TTF_Quit();
-    SDL_Quit();
+    initSounds();
 }
 
-// Procedurally generate a dungeon with rooms and corridors
-void generateDungeon() {
-    // Fill map with walls
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
-            map[y][x] = '#';
-        }
+// Render every sound effect into one buffer in the mixer's format. The
+// game plays silently if the mixer isn't open or uses another format.
+void initSounds() {
+    int rate, channels;
+    Uint16 format;
+    if (Mix_QuerySpec(&rate, &format, &channels) == 0) {
+        return; // Mixer not open; already reported
     }
-    
-    // Create random rooms
-    numRooms = 0;
-    for (int i = 0; i < MAX_ROOMS; i++) {
-        int roomWidth = rand() % 10 + 5; // Room width 5-14
-        int roomHeight = rand() % 8 + 4; // Room height 4-11
-        
-        // Ensure rooms are within map boundaries
-        int roomX = rand() % (MAP_WIDTH - roomWidth - 2) + 1;
-        int roomY = rand() % (MAP_HEIGHT - roomHeight - 2) + 1;
-        
-        // Check for overlap with existing rooms
-        int overlaps = 0;
-        for (int j = 0; j < numRooms; j++) {
-            if (roomX < rooms[j].x + rooms[j].width && roomX + roomWidth > rooms[j].x &&
-                roomY < rooms[j].y + rooms[j].height && roomY + roomHeight > rooms[j].y) {
-                overlaps = 1;
-                break;
-            }
-        }
-
-        if (!overlaps) {
-            createRoom(roomX, roomY, roomWidth, roomHeight);
-            rooms[numRooms].x = roomX;
-            rooms[numRooms].y = roomY;
-            rooms[numRooms].width = roomWidth;
-            rooms[numRooms].height = roomHeight;
-            numRooms++;
-        }
+    if (format != AUDIO_S16SYS || synthPatchCount > (int)(sizeof(soundChunks) / sizeof(soundChunks[0]))) {
+        printf("Sound effects need 16-bit audio; playing without them\n");
+        return;
     }
 
-    // Connect the rooms
-    connectRooms();
-
-    // Place the player in the center of the first room
-    if (numRooms > 0) {
-        player.x = rooms[0].x + rooms[0].width / 2;
-        player.y = rooms[0].y + rooms[0].height / 2;
-    } else {
-        // If no rooms were created, place the player in a safe default location
-        player.x = MAP_WIDTH / 2;
-        player.y = MAP_HEIGHT / 2;
-        map[player.y][player.x] = '.';
+    size_t totalFrames = 0;
+    for (int i = 0; i < synthPatchCount; i++) {
+        totalFrames += synthFrames(&synthPatches[i], rate);
     }
-    
-    // Place potions and food
-    placePotions();
-    placeFood();
-    
-    // Place stairs down if not the final level
-    if (numRooms > 1 && dungeonLevel < 5) {
-        int lastRoomIndex = numRooms - 1;
-        int stairsX = rooms[lastRoomIndex].x + rooms[lastRoomIndex].width / 2;
-        int stairsY = rooms[lastRoomIndex].y + rooms[lastRoomIndex].height / 2;
-        map[stairsY][stairsX] = '>';
+    soundBank = malloc(totalFrames * channels * sizeof(Sint16));
+    if (soundBank == NULL) {
+        printf("Out of memory for sound effects\n");
+        return;
     }
-    
-    // Initialize visibility map
-    for (int y = 0; y < MAP_HEIGHT; y++) {
-        for (int x = 0; x < MAP_WIDTH; x++) {
-            visibility[y][x] = 0;
+    Sint16* samples = soundBank;
+    for (int i = 0; i < synthPatchCount; i++) {
+        size_t frames = synthFrames(&synthPatches[i], rate);
+        renderSynthPatch(&synthPatches[i], rate, channels, samples);
+        soundChunks[i] = Mix_QuickLoad_RAW((Uint8*)samples, (Uint32)(frames * channels * sizeof(Sint16)));
+        if (soundChunks[i] == NULL) {
+            printf("Failed to load sound effect %d! Mix_Error: %s\n", i, Mix_GetError());
         }
+        samples += frames * channels;
     }
 }
 
-// Helper function to carve out a room
-void createRoom(int x, int y, int width, int height) {
-    for (int i = y; i < y + height; i++) {
-        for (int j = x; j < x + width; j++) {
-            map[i][j] = '.';
-        }
+// Clean up SDL resources
+void closeSDL() {
+    for (int i = 0; i < MESSAGE_LOG_SIZE; i++) {
+        freeCachedText(&messageLines[i]);
     }
-}
-
-// Connect the rooms with corridors
-void connectRooms() {
-    for (int i = 0; i < numRooms - 1; i++) {
-        int x1 = rooms[i].x + rooms[i].width / 2;
-        int y1 = rooms[i].y + rooms[i].height / 2;
-        int x2 = rooms[i+1].x + rooms[i+1].width / 2;
-        int y2 = rooms[i+1].y + rooms[i+1].height / 2;
-
-        // Carve horizontal corridor
-        if (x1 < x2) {
-            for (int x = x1; x <= x2; x++) {
-                map[y1][x] = '.';
-            }
-        } else {
-            for (int x = x2; x <= x1; x++) {
-                map[y1][x] = '.';
-            }
-        }
-
-        // Carve vertical corridor
-        if (y1 < y2) {
-            for (int y = y1; y <= y2; y++) {
-                map[y][x2] = '.';
-            }
-        } else {
-            for (int y = y2; y <= y1; y++) {
-                map[y][x2] = '.';
-            }
-        }
+    for (int i = 0; i < HUD_WIDGETS; i++) {
+        freeCachedText(&hudWidgets[i].text);
     }
-}
-
-// Place monsters in the dungeon
-void placeMonsters() {
-    if (dungeonLevel == 5) {
-        // Place the final boss on level 5
-        monsters[0] = finalBossTemplate;
-        monsters[0].hp = finalBossTemplate.hp * 2; // Make boss even stronger
-        monsters[0].points = finalBossTemplate.points * 2; // More points for the boss
-        monsters[0].active = 1;
-        
-        int placed = 0;
-        int attempt = 0;
-        while (!placed && attempt < 100) {
-            int x = rooms[numRooms-1].x + rooms[numRooms-1].width / 2;
-            int y = rooms[numRooms-1].y + rooms[numRooms-1].height / 2;
-            if (map[y][x] == '.' && (x != player.x || y != player.y)) {
-                monsters[0].x = x;
-                monsters[0].y = y;
-                placed = 1;
-            }
-            attempt++;
-        }
-        for (int i = 1; i < MAX_MONSTERS; i++) {
-            monsters[i].active = 0; // Deactivate other monsters on the final level
-        }
-
-    } else {
-        for (int i = 0; i < MAX_MONSTERS; i++) {
-            // Randomly choose a monster type from the templates
-            int type = rand() % NUM_MONSTER_TYPES;
-            monsters[i] = monsterTemplates[type];
-            monsters[i].active = 1; // All monsters are active
-            
-            // Scale monster stats with dungeon level
-            monsters[i].hp += dungeonLevel * 2;
-            monsters[i].points += dungeonLevel * 5;
-
-            // Find a random valid floor tile to place the monster
-            int placed = 0;
-            int attempt = 0;
-            while (!placed && attempt < 100) {
-                int x = rand() % MAP_WIDTH;
-                int y = rand() % MAP_HEIGHT;
-                if (map[y][x] == '.' && (x != player.x || y != player.y)) {
-                    monsters[i].x = x;
-                    monsters[i].y = y;
-                    placed = 1;
-                }
-                attempt++;
-            }
-            if (!placed) {
-                monsters[i].active = 0; // If no space is found, deactivate the monster
-            }
-        }
-    }
-}
-
-// Place potions on the floor
-void placePotions() {
-    if (rand() % 3 == 0) { // 33% chance to place a potion on a new level
-        int placed = 0;
-        while(!placed) {
-            int x = rand() % MAP_WIDTH;
-            int y = rand() % MAP_HEIGHT;
-            if (map[y][x] == '.' && (x != player.x || y != player.y)) {
-                map[y][x] = '!'; // Potion symbol
-                placed = 1;
-            }
-        }
-    }
-}
-
-// Place food on the floor
-void placeFood() {
-    if (rand() % 2 == 0) { // 50% chance to place food on a new level
-        int placed = 0;
-        while(!placed) {
-            int x = rand() % MAP_WIDTH;
-            int y = rand() % MAP_HEIGHT;
-            if (map[y][x] == '.' && (x != player.x || y != player.y)) {
-                map[y][x] = 'F'; // Food symbol
-                placed = 1;
-            }
-        }
+    for (int i = 0; i < synthPatchCount; i++) {
+        Mix_FreeChunk(soundChunks[i]); // Leaves soundBank alone
+        soundChunks[i] = NULL;
     }
+    free(soundBank);
+    soundBank = NULL;
+    Mix_Quit();
+    closePerfOverlay();
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    window = NULL;
+    renderer = NULL;
+    closeText();
+    freeAssets(); // After the font that was reading from it
+    SDL_Quit();
 }
 
 // Handle player input for playing state
 int handlePlayingInput(SDL_Event* e) {
+    // Click on an explored tile to walk there
+    if (e->type == SDL_MOUSEBUTTONDOWN && e->button.button == SDL_BUTTON_LEFT && !isAwaitingSpellDirection) {
+        return playerTravel(TRAVEL_TILE, e->button.x / TILE_SIZE + cameraX, e->button.y / TILE_SIZE + cameraY);
+    }
     if (e->type == SDL_KEYDOWN) {
+        Action action = {ACTION_NONE, 0, 0};
+
         // If we were waiting for a spell direction, and a directional key is pressed
         if (isAwaitingSpellDirection) {
             int dx = 0, dy = 0;
@@ -546,430 +398,203 @@ int handlePlayingInput(SDL_Event* e) {
                     return 0; // No turn passed
             }
             isAwaitingSpellDirection = 0;
-            castMagicMissile(dx, dy);
-            return 1; // A turn has passed
+            action.type = ACTION_MISSILE;
+            action.dx = dx;
+            action.dy = dy;
+            return playerAction(action);
         }
-        
-        int newX = player.x;
-        int newY = player.y;
-        int playerMoved = 0;
 
         switch (e->key.keysym.sym) {
             case SDLK_UP:
-                // Only process movement if not starving or if a new key is pressed
-                if (player.isStarving == 0 || e->key.repeat == 0) {
-                    newY--;
-                    playerMoved = 1;
-                }
-                break;
             case SDLK_DOWN:
-                if (player.isStarving == 0 || e->key.repeat == 0) {
-                    newY++;
-                    playerMoved = 1;
-                }
-                break;
             case SDLK_LEFT:
-                if (player.isStarving == 0 || e->key.repeat == 0) {
-                    newX--;
-                    playerMoved = 1;
-                }
-                break;
             case SDLK_RIGHT:
-                if (player.isStarving == 0 || e->key.repeat == 0) {
-                    newX++;
-                    playerMoved = 1;
+                // Only process movement if not starving or if a new key is pressed
+                if (player.isStarving != 0 && e->key.repeat != 0) {
+                    return 0;
                 }
-                break;
+                action.type = ACTION_MOVE;
+                action.dx = e->key.keysym.sym == SDLK_LEFT ? -1 : e->key.keysym.sym == SDLK_RIGHT ? 1 : 0;
+                action.dy = e->key.keysym.sym == SDLK_UP ? -1 : e->key.keysym.sym == SDLK_DOWN ? 1 : 0;
+                if (e->key.keysym.mod & KMOD_SHIFT) {
+                    return playerRepeat(action); // Run
+                }
+                return playerAction(action);
             case SDLK_r: // New rest functionality
-                if (e->key.repeat == 0) {
-                    if (isOccupiedByMonster(player.x-1, player.y) != -1 || isOccupiedByMonster(player.x+1, player.y) != -1 ||
-                        isOccupiedByMonster(player.x, player.y-1) != -1 || isOccupiedByMonster(player.x, player.y+1) != -1) {
-                            showMessage("You can't rest while adjacent to a monster!");
-                            return 0;
-                    }
-                    restCounter++;
-                    if (restCounter >= REST_TURNS_REQUIRED) {
-                        player.hp++;
-                        if (player.hp > player.maxHp) player.hp = player.maxHp;
-                        player.mana++;
-                        if (player.mana > player.maxMana) player.mana = player.maxMana;
-                        restCounter = 0;
-                        showMessage("You have rested and recovered 1 HP and 1 Mana!");
-                    } else {
-                        char tempBuffer[256];
-                        snprintf(tempBuffer, sizeof(tempBuffer), "Resting... (Turn %d/%d)", restCounter, REST_TURNS_REQUIRED);
-                        showMessage(tempBuffer);
-                    }
-                    player.hunger += 5; // Resting makes you hungrier
-                    return 1; // A turn has passed
+                if (e->key.repeat != 0) {
+                    return 0;
                 }
-                return 0;
+                action.type = ACTION_REST;
+                if (e->key.keysym.mod & KMOD_SHIFT) {
+                    return playerRepeat(action); // Rest until healed
+                }
+                return playerAction(action);
             case SDLK_h: // Heal spell
-                castHealSpell();
-                return 1;
+                action.type = ACTION_HEAL;
+                return playerAction(action);
             case SDLK_f: // Magic Missile spell
                 isAwaitingSpellDirection = 1;
                 showMessage("Choose a direction for magic missile!");
                 return 0; // No turn passed yet
             case SDLK_t: // Teleportation spell
-                castPhaseDoorSpell();
-                return 1; // A turn has passed
+                action.type = ACTION_PHASE_DOOR;
+                return playerAction(action);
             case SDLK_e: // Eat food
-                eatFood();
-                return 1;
+                action.type = ACTION_EAT;
+                return playerAction(action);
             case SDLK_p: // Use health potion
-                useHealthPotion();
-                return 1;
+                action.type = ACTION_POTION;
+                return playerAction(action);
+            case SDLK_s: // Save game
+                if (replayMode) {
+                    showMessage("Saving is disabled while watching a replay.");
+                    return 0;
+                }
+                autosave(); // Written in the background
+                showMessage("Game saved.");
+                return 0; // Saving doesn't take a turn
+            case SDLK_l: // Load saved game
+                waitForAutosave(); // Don't read a save that is still being written
+                if (loadGame(SAVE_FILE) == 0) {
+                    isAwaitingSpellDirection = 0;
+                    showMessage("Game loaded.");
+                    if (!replayMode) {
+                        startRecording(REPLAY_FILE); // The recording restarts from the loaded game
+                    }
+                } else {
+                    showMessage("No saved game to load!");
+                }
+                return 0;
+            case SDLK_x: // Auto-explore
+                return playerTravel(TRAVEL_EXPLORE, 0, 0);
+            case SDLK_PERIOD: // '>' on most layouts: travel to the stairs
+                if (!(e->key.keysym.mod & KMOD_SHIFT)) {
+                    return 0;
+                }
+                return playerTravel(TRAVEL_STAIRS, 0, 0);
+            case SDLK_GREATER:
+                return playerTravel(TRAVEL_STAIRS, 0, 0);
+            case SDLK_PAGEUP: // Message history
+                scrollMessageHistory(MESSAGE_HISTORY_LINES / 2);
+                return 0;
+            case SDLK_PAGEDOWN:
+                scrollMessageHistory(-MESSAGE_HISTORY_LINES / 2);
+                return 0;
             case SDLK_SLASH:
                 gameState = STATE_HELP;
                 return 0; // No turn passed
             default:
                 return 0; // No action taken
         }
-
-        if (playerMoved) {
-            // Check if the new position is a floor tile and not a wall
-            if (newX >= 0 && newX < MAP_WIDTH && newY >= 0 && newY < MAP_HEIGHT && map[newY][newX] != '#') {
-                
-                // Check for stairs
-                if (map[newY][newX] == '>') {
-                    dungeonLevel++;
-                    generateDungeon();
-                    placeMonsters();
-                    showMessage("You descend to a new level!");
-                    return 1;
-                }
-                
-                // Check for potion
-                if (map[newY][newX] == '!') {
-                    player.healthPotions++;
-                    map[newY][newX] = '.';
-                    showMessage("You found a health potion!");
-                }
-                
-                // Check for food
-                if (map[newY][newX] == 'F') {
-                    player.foodInInventory++;
-                    map[newY][newX] = '.';
-                    showMessage("You found some food!");
-                }
-
-                // Check for a monster in the new position
-                int monsterIndex = -1;
-                for (int i = 0; i < MAX_MONSTERS; i++) {
-                    if (monsters[i].active && monsters[i].x == newX && monsters[i].y == newY) {
-                        monsterIndex = i;
-                        break;
-                    }
-                }
-
-                if (monsterIndex != -1) {
-                    // Monster found, initiate combat
-                    fightMonster(monsterIndex);
-                    return 1; // A turn has passed
-                } else {
-                    // No monster, move the player
-                    player.x = newX;
-                    player.y = newY;
-                    return 1; // A turn has passed
-                }
-            }
-        }
     }
     return 0; // No turn passed
 }
 
-// Handle player input for help screen
-int handleHelpInput(SDL_Event* e) {
-    // Escape key handling is in the main loop
-    return 0;
+// Record an action for replays, play the turn and show what happened
+int playerAction(Action action) {
+    int level = dungeonLevel;
+    recordAction(action); // Before playing, so a crash mid-turn is still on record
+    Uint64 turnStart = SDL_GetPerformanceCounter();
+    int turnPassed = playTurn(action);
+    addTurnSample(SDL_GetPerformanceCounter() - turnStart);
+    recordTurnEnd();
+    presentTurn(level, turnPassed);
+    return turnPassed;
 }
 
-// Monster movement AI
-void moveMonsters() {
-    for (int i = 0; i < MAX_MONSTERS; i++) {
-        if (monsters[i].active) {
-            // Monsters move based on their speed
-            for (int j = 0; j < monsters[i].speed; j++) {
-                // Check if player is in range
-                if (getDistance(monsters[i].x, monsters[i].y, player.x, player.y) <= MONSTER_DETECTION_RANGE) {
-                    int dx = player.x - monsters[i].x;
-                    int dy = player.y - monsters[i].y;
-                    int newX = monsters[i].x;
-                    int newY = monsters[i].y;
-                    int moved = 0;
-                    
-                    // Prioritize movement on the axis with the greater distance
-                    if (abs(dx) > abs(dy)) {
-                        newX += (dx > 0) ? 1 : -1;
-                        if (newX >= 0 && newX < MAP_WIDTH && newY >= 0 && newY < MAP_HEIGHT &&
-                            map[newY][newX] != '#' && (newX != player.x || newY != player.y) &&
-                            isOccupiedByMonster(newX, newY) == -1) {
-                            monsters[i].x = newX;
-                            moved = 1;
-                        }
-                    } else {
-                        newY += (dy > 0) ? 1 : -1;
-                        if (newX >= 0 && newX < MAP_WIDTH && newY >= 0 && newY < MAP_HEIGHT &&
-                            map[newY][newX] != '#' && (newX != player.x || newY != player.y) &&
-                            isOccupiedByMonster(newX, newY) == -1) {
-                            monsters[i].y = newY;
-                            moved = 1;
-                        }
-                    }
-
-                    // If the primary move failed, try the secondary move
-                    if (!moved) {
-                        if (abs(dx) > abs(dy)) {
-                            newY = monsters[i].y + ((dy > 0) ? 1 : -1);
-                            if (newY >= 0 && newY < MAP_HEIGHT &&
-                                map[newY][monsters[i].x] != '#' &&
-                                (monsters[i].x != player.x || newY != player.y) &&
-                                isOccupiedByMonster(monsters[i].x, newY) == -1) {
-                                monsters[i].y = newY;
-                            }
-                        } else {
-                            newX = monsters[i].x + ((dx > 0) ? 1 : -1);
-                            if (newX >= 0 && newX < MAP_WIDTH &&
-                                map[monsters[i].y][newX] != '#' &&
-                                (newX != player.x || monsters[i].y != player.y) &&
-                                isOccupiedByMonster(newX, monsters[i].y) == -1) {
-                                monsters[i].x = newX;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+// Play a multi-turn command (see RepeatCommand). The turns run back to
+// back and are recorded one by one; only the result is drawn.
+int playerRepeat(Action action) {
+    RepeatCommand command;
+    if (!startRepeat(&command, action, 0)) {
+        return 0;
     }
+    int level = dungeonLevel;
+    int turnPassed;
+    do {
+        recordAction(action);
+        Uint64 turnStart = SDL_GetPerformanceCounter();
+        turnPassed = playTurn(action);
+        addTurnSample(SDL_GetPerformanceCounter() - turnStart);
+        recordTurnEnd();
+    } while (continueRepeat(&command, turnPassed));
+    presentTurn(level, command.turns);
+    return command.turns > 0;
 }
 
-
-// Handle combat between player and monster
-void fightMonster(int monsterIndex) {
-    char tempBuffer[256];
-    int playerDamage = rand() % (player.intelligence * 2) + 1;
-    monsters[monsterIndex].hp -= playerDamage;
-    snprintf(tempBuffer, sizeof(tempBuffer), "You hit the %s for %d damage!", monsters[monsterIndex].name, playerDamage);
-    showMessage(tempBuffer);
-
-    if (monsters[monsterIndex].hp <= 0) {
-        player.score += monsters[monsterIndex].points;
-        player.xp += monsters[monsterIndex].points; // Gain XP for defeating a monster
-        
-        // 50% chance to drop a food item
-        if (rand() % 2 == 0) {
-            player.foodInInventory++;
-            snprintf(tempBuffer, sizeof(tempBuffer), "You defeated the %s and found some food!", monsters[monsterIndex].name);
-        } else {
-            snprintf(tempBuffer, sizeof(tempBuffer), "You defeated the %s!", monsters[monsterIndex].name);
-        }
-        monsters[monsterIndex].active = 0;
-        showMessage(tempBuffer);
-    } else {
-        int monsterDamage = rand() % (5 + dungeonLevel) + 1; // Monsters do 1-5 damage + dungeon level
-        player.hp -= monsterDamage;
-        if (player.hp <= 0) {
-            strncpy(player.causeOfDeath, monsters[monsterIndex].name, sizeof(player.causeOfDeath) - 1);
-            player.causeOfDeath[sizeof(player.causeOfDeath) - 1] = '\0';
+// Auto-explore or travel (see travel.h), drawing only where the walk ends
+int playerTravel(TravelKind kind, int x, int y) {
+    TravelCommand travel;
+    Action action;
+    if (!startTravel(&travel, kind, x, y)) {
+        return 0;
+    }
+    int level = dungeonLevel;
+    while (nextTravelStep(&travel, &action)) {
+        recordAction(action);
+        Uint64 turnStart = SDL_GetPerformanceCounter();
+        int turnPassed = playTurn(action);
+        addTurnSample(SDL_GetPerformanceCounter() - turnStart);
+        recordTurnEnd();
+        if (!continueRepeat(&travel.repeat, turnPassed)) {
+            break;
         }
-        snprintf(tempBuffer, sizeof(tempBuffer), "The %s hits you for %d damage! Your HP is now %d/%d.", monsters[monsterIndex].name, monsterDamage, player.hp, player.maxHp);
-        showMessage(tempBuffer);
     }
+    presentTurn(level, travel.repeat.turns);
+    return travel.repeat.turns > 0;
 }
 
-// New rest function to recover HP and Mana
-void rest() {
-    char tempBuffer[256];
-    restCounter++;
-    if (restCounter >= REST_TURNS_REQUIRED) {
-        player.hp++;
-        if (player.hp > player.maxHp) player.hp = player.maxHp;
-        player.mana++;
-        if (player.mana > player.maxMana) player.mana = player.maxMana;
-        restCounter = 0;
-        snprintf(tempBuffer, sizeof(tempBuffer), "You have rested and recovered 1 HP and 1 Mana!");
-    } else {
-        snprintf(tempBuffer, sizeof(tempBuffer), "Resting... (Turn %d/%d)", restCounter, REST_TURNS_REQUIRED);
+// Play the sounds and animations the turns left behind, and keep the
+// autosave schedule: every AUTOSAVE_INTERVAL turns and on each new level
+void presentTurn(int previousLevel, int turnsPlayed) {
+    if (turnsPlayed > 0) {
+        messageHistoryScroll = -1; // Back to the latest messages
     }
-    showMessage(tempBuffer);
-}
-
-// New healing spell
-void castHealSpell() {
-    char tempBuffer[256];
-    int manaCost = 3;
-    if (player.mana >= manaCost) {
-        player.mana -= manaCost;
-        int healAmount = rand() % 5 + 3 + player.intelligence; // Heal for 3-7 + int amount
-        player.hp += healAmount;
-        if (player.hp > player.maxHp) {
-            player.hp = player.maxHp;
+    for (int i = 0; i < synthPatchCount; i++) {
+        if ((pendingSounds & synthPatches[i].sound) && soundChunks[i] != NULL) {
+            Mix_PlayChannel(-1, soundChunks[i], 0);
         }
-        snprintf(tempBuffer, sizeof(tempBuffer), "You cast a healing spell and recover %d HP!", healAmount);
-    } else {
-        snprintf(tempBuffer, sizeof(tempBuffer), "Not enough mana to cast the healing spell!");
     }
-    showMessage(tempBuffer);
-}
-
-// New magic missile spell
-void castMagicMissile(int dx, int dy) {
-    char tempBuffer[256];
-    int manaCost = 2;
-    if (player.mana < manaCost) {
-        snprintf(tempBuffer, sizeof(tempBuffer), "Not enough mana to cast magic missile!");
-        showMessage(tempBuffer);
-        return;
+    pendingSounds = 0;
+    if (!fastForward) {
+        animateEffects();
     }
+    numEffects = 0;
 
-    player.mana -= manaCost;
-    
-    // Animate missile
-    int missileX = player.x;
-    int missileY = player.y;
-
-    while(1) {
-        missileX += dx;
-        missileY += dy;
-
-        // Check for collision with wall or map boundaries
-        if (missileX < 0 || missileX >= MAP_WIDTH || missileY < 0 || missileY >= MAP_HEIGHT || map[missileY][missileX] == '#') {
-            snprintf(tempBuffer, sizeof(tempBuffer), "The magic missile hits a wall!");
-            break;
-        }
-
-        // Check for collision with monster
-        int monsterIndex = isOccupiedByMonster(missileX, missileY);
-        if (monsterIndex != -1) {
-            int damage = rand() % 5 + 1 + player.intelligence;
-            monsters[monsterIndex].hp -= damage;
-            snprintf(tempBuffer, sizeof(tempBuffer), "You cast magic missile at the %s for %d damage!", monsters[monsterIndex].name, damage);
-            if (monsters[monsterIndex].hp <= 0) {
-                player.score += monsters[monsterIndex].points;
-                player.xp += monsters[monsterIndex].points; // Gain XP for defeating a monster
-                
-                snprintf(tempBuffer, sizeof(tempBuffer), "You defeated the %s!", monsters[monsterIndex].name);
-                monsters[monsterIndex].active = 0;
-            }
-            break;
-        }
+    if (dungeonLevel != previousLevel) {
+        autosave();
+    } else if ((turnsSinceAutosave += turnsPlayed) >= AUTOSAVE_INTERVAL) {
+        autosave();
+    }
+}
 
-        // Update screen to show missile
+// Show the frames queued by the last turn, such as a missile in flight.
+// A volley of bolts shares its frames, so it takes no longer than one.
+void animateEffects() {
+    TRACE_SCOPE("animateEffects");
+    for (int i = 0; i < numEffects;) {
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
         SDL_RenderClear(renderer);
         renderGame();
-        drawText("*", (missileX-cameraX)*TILE_SIZE, (missileY-cameraY)*TILE_SIZE, (SDL_Color){255, 255, 0, 255});
+        int frame = effects[i].frame;
+        for (; i < numEffects && effects[i].frame == frame; i++) {
+            char symbol[2] = {effects[i].symbol, '\0'};
+            drawText(symbol, (effects[i].x-cameraX)*TILE_SIZE, (effects[i].y-cameraY)*TILE_SIZE, (SDL_Color){255, 255, 0, 255});
+        }
         SDL_RenderPresent(renderer);
         SDL_Delay(20);
     }
-
-    showMessage(tempBuffer);
 }
 
-// New Phase Door spell
-void castPhaseDoorSpell() {
-    char tempBuffer[256];
-    int manaCost = 5;
-    if (player.mana < manaCost) {
-        snprintf(tempBuffer, sizeof(tempBuffer), "Not enough mana to cast Phase Door!");
-        showMessage(tempBuffer);
-        return;
-    }
-
-    player.mana -= manaCost;
-
-    // Find a random, empty, walkable tile to teleport to
-    int newX, newY;
-    int attempts = 0;
-    do {
-        newX = rand() % MAP_WIDTH;
-        newY = rand() % MAP_HEIGHT;
-        attempts++;
-        if (attempts > 1000) {
-            snprintf(tempBuffer, sizeof(tempBuffer), "The spell fails to find a safe location!");
-            showMessage(tempBuffer);
-            return;
-        }
-    } while (!isTileWalkable(newX, newY) || isOccupiedByMonster(newX, newY) != -1);
-    
-    player.x = newX;
-    player.y = newY;
-    
-    snprintf(tempBuffer, sizeof(tempBuffer), "You cast Phase Door and teleport to a new location!");
-    showMessage(tempBuffer);
-}
-
-
-// New function to use a health potion
-void useHealthPotion() {
-    char tempBuffer[256];
-    if (player.healthPotions > 0) {
-        player.healthPotions--;
-        int healAmount = rand() % 8 + 5; // Heal for 5-12 HP
-        player.hp += healAmount;
-        if (player.hp > player.maxHp) {
-            player.hp = player.maxHp;
-        }
-        snprintf(tempBuffer, sizeof(tempBuffer), "You use a health potion and recover %d HP!", healAmount);
-    } else {
-        snprintf(tempBuffer, sizeof(tempBuffer), "You have no health potions!");
-    }
-    showMessage(tempBuffer);
-}
-
-// New function to eat food
-void eatFood() {
-    char tempBuffer[256];
-    if (player.foodInInventory > 0) {
-        player.foodInInventory--;
-        player.hunger = 0;
-        snprintf(tempBuffer, sizeof(tempBuffer), "You eat the food and are no longer hungry!");
-    } else {
-        snprintf(tempBuffer, sizeof(tempBuffer), "You have no food!");
-    }
-    showMessage(tempBuffer);
-}
-
-// Check if player has enough XP to level up
-void checkLevelUp() {
-    if (player.xp >= player.xpToNextLevel) {
-        player.level++;
-        player.xp -= player.xpToNextLevel; // Reset XP for the new level
-        player.xpToNextLevel = player.xpToNextLevel * 2; // Increase XP required for the next level
-        player.maxHp += 5; // Increase max HP
-        player.hp = player.maxHp; // Fully heal on level up
-        player.maxMana += 2; // Increase max Mana
-        player.mana = player.maxMana; // Fully restore mana
-        player.intelligence++; // Increase intelligence
-        
-        gameState = STATE_LEVELUP;
-    }
-}
-
-// Mark tiles within the player's sight as explored
-void updateVisibility() {
-    int startX = player.x - player.visibilityRadius;
-    int endX   = player.x + player.visibilityRadius;
-    int startY = player.y - player.visibilityRadius;
-    int endY   = player.y + player.visibilityRadius;
-
-    if (startX < 0) startX = 0;
-    if (startY < 0) startY = 0;
-    if (endX >= MAP_WIDTH) endX = MAP_WIDTH - 1;
-    if (endY >= MAP_HEIGHT) endY = MAP_HEIGHT - 1;
-
-    for (int y = startY; y <= endY; y++) {
-        for (int x = startX; x <= endX; x++) {
-            if (getDistance(player.x, player.y, x, y) <= player.visibilityRadius) {
-                visibility[y][x] = 1;
-            }
-        }
-    }
+// Handle player input for help screen
+int handleHelpInput(SDL_Event* e) {
+    // Escape key handling is in the main loop
+    return 0;
 }
 
 // Render the game state to the screen
 void renderGame() {
+    TRACE_SCOPE("renderGame");
     // Center the camera on the player
     cameraX = player.x - SCREEN_WIDTH / (2 * TILE_SIZE);
     cameraY = player.y - SCREEN_HEIGHT / (2 * TILE_SIZE);
@@ -1048,13 +673,94 @@ void renderGame() {
     drawText(playerChar, playerScreenX, playerScreenY, (SDL_Color){0, 255, 0, 255}); // Green for player
 
     // Render player stats at the top of the screen (fixed position)
-    char statsBuffer[256];
-    snprintf(statsBuffer, sizeof(statsBuffer), "HP: %d/%d | Mana: %d/%d | Int: %d | Score: %d | Potions: %d | Food: %d | Lvl: %d | XP: %d/%d | Dlvl: %d",
-            player.hp, player.maxHp, player.mana, player.maxMana, player.intelligence, player.score, player.healthPotions, player.foodInInventory, player.level, player.xp, player.xpToNextLevel, dungeonLevel);
-    drawText(statsBuffer, 10, 10, (SDL_Color){255, 255, 255, 255});
+    int hudEnd = renderHud(10, 10);
+    // Toggled with F3; next to the stats line, or under it if there's no room
+    if (!renderPerfOverlay(hudEnd + TILE_SIZE, 10)) {
+        renderPerfOverlay(10, 10 + TILE_SIZE);
+    }
 
     // Render message log at the bottom of the screen (fixed position)
-    drawText(messageBuffer, 10, SCREEN_HEIGHT - TILE_SIZE, (SDL_Color){255, 255, 255, 255});
+    renderMessageLog();
+}
+
+// The values a HUD widget shows; the second is 0 for single values
+void readHudValues(HudField field, int values[2]) {
+    values[1] = 0;
+    switch (field) {
+        case HUD_HP: values[0] = player.hp; values[1] = player.maxHp; break;
+        case HUD_MANA: values[0] = player.mana; values[1] = player.maxMana; break;
+        case HUD_INTELLIGENCE: values[0] = player.intelligence; break;
+        case HUD_SCORE: values[0] = player.score; break;
+        case HUD_POTIONS: values[0] = player.healthPotions; break;
+        case HUD_FOOD: values[0] = player.foodInInventory; break;
+        case HUD_LEVEL: values[0] = player.level; break;
+        case HUD_XP: values[0] = player.xp; values[1] = player.xpToNextLevel; break;
+        default: values[0] = dungeonLevel; break;
+    }
+}
+
+// Draw the stats line, widget by widget from left to right. Most frames
+// only compare a few numbers and redraw the cached textures.
+int renderHud(int x, int y) {
+    for (int i = 0; i < HUD_WIDGETS; i++) {
+        HudWidget* widget = &hudWidgets[i];
+        int values[2];
+        readHudValues((HudField)i, values);
+        if (!widget->valid || values[0] != widget->values[0] || values[1] != widget->values[1]) {
+            snprintf(widget->label, sizeof(widget->label), hudFormats[i], values[0], values[1]);
+            widget->values[0] = values[0];
+            widget->values[1] = values[1];
+            widget->valid = 1;
+        }
+        x += drawCachedText(&widget->text, widget->label, x, y, (SDL_Color){255, 255, 255, 255});
+    }
+    return x;
+}
+
+// Draw the messages of the latest turn, or a page of history, upwards
+// from the bottom of the screen. Each line keeps its texture until its
+// slot in the log is reused, so a quiet frame renders no text at all.
+void renderMessageLog() {
+    uint32_t first, last = messageLog.count; // Message numbers, last excluded
+    if (messageHistoryScroll >= 0) {
+        last -= messageHistoryScroll;
+        first = last > MESSAGE_HISTORY_LINES ? last - MESSAGE_HISTORY_LINES : 0;
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+        SDL_Rect rect = {0, SCREEN_HEIGHT - TILE_SIZE * (MESSAGE_HISTORY_LINES + 1), SCREEN_WIDTH, TILE_SIZE * (MESSAGE_HISTORY_LINES + 1)};
+        SDL_RenderFillRect(renderer, &rect);
+        drawText("--- Messages (PgUp/PgDn) ---", 10, rect.y, (SDL_Color){255, 255, 0, 255});
+    } else {
+        first = messageLog.firstRecent;
+        if (last - first > MESSAGE_BURST_LINES) {
+            first = last - MESSAGE_BURST_LINES;
+        }
+    }
+
+    int y = SCREEN_HEIGHT - TILE_SIZE * (int)(last - first);
+    for (uint32_t number = first; number < last; number++, y += TILE_SIZE) {
+        const char* line = messageLogLine(number);
+        if (line != NULL) {
+            drawCachedText(&messageLines[number % MESSAGE_LOG_SIZE], line, 10, y, (SDL_Color){255, 255, 255, 255});
+        }
+    }
+}
+
+// Open the history or move through it; scrolling past the newest
+// message closes it again
+void scrollMessageHistory(int lines) {
+    int kept = messageLog.count < MESSAGE_LOG_SIZE ? (int)messageLog.count : MESSAGE_LOG_SIZE;
+    int oldest = kept > MESSAGE_HISTORY_LINES ? kept - MESSAGE_HISTORY_LINES : 0;
+    if (messageHistoryScroll < 0) {
+        messageHistoryScroll = lines > 0 ? 0 : -1;
+        return;
+    }
+    messageHistoryScroll += lines;
+    if (messageHistoryScroll > oldest) {
+        messageHistoryScroll = oldest;
+    } else if (messageHistoryScroll < 0) {
+        messageHistoryScroll = -1;
+    }
 }
 
 // Function to render the game over screen
@@ -1079,7 +785,7 @@ void renderGameOverScreen() {
     line = strtok(tombstoneCopy, "\n");
     while(line != NULL) {
         int textWidth, textHeight;
-        TTF_SizeText(font, line, &textWidth, &textHeight);
+        sizeText(line, &textWidth, &textHeight);
         drawText(line, (SCREEN_WIDTH - textWidth) / 2, yOffset, (SDL_Color){255, 255, 255, 255});
         yOffset += textHeight;
         line = strtok(NULL, "\n");
@@ -1088,19 +794,19 @@ void renderGameOverScreen() {
     char deathMessage[100];
     snprintf(deathMessage, sizeof(deathMessage), "You have died!");
     int deathMessageWidth;
-    TTF_SizeText(font, deathMessage, &deathMessageWidth, NULL);
+    sizeText(deathMessage, &deathMessageWidth, NULL);
     drawText(deathMessage, (SCREEN_WIDTH - deathMessageWidth) / 2, yOffset + 24, (SDL_Color){255, 255, 255, 255});
 
     char causeMessage[100];
     snprintf(causeMessage, sizeof(causeMessage), "Cause of Death: %s", player.causeOfDeath);
     int causeMessageWidth;
-    TTF_SizeText(font, causeMessage, &causeMessageWidth, NULL);
+    sizeText(causeMessage, &causeMessageWidth, NULL);
     drawText(causeMessage, (SCREEN_WIDTH - causeMessageWidth) / 2, yOffset + 48, (SDL_Color){255, 255, 255, 255});
 
     char scoreMessage[100];
     snprintf(scoreMessage, sizeof(scoreMessage), "Final Score: %d", player.score);
     int scoreMessageWidth;
-    TTF_SizeText(font, scoreMessage, &scoreMessageWidth, NULL);
+    sizeText(scoreMessage, &scoreMessageWidth, NULL);
     drawText(scoreMessage, (SCREEN_WIDTH - scoreMessageWidth) / 2, yOffset + 72, (SDL_Color){255, 255, 255, 255});
 
     SDL_RenderPresent(renderer);
@@ -1122,8 +828,14 @@ void renderHelpScreen() {
     yPos += TILE_SIZE;
     drawText("Arrow Keys: Move", xPos, yPos, (SDL_Color){255, 255, 255, 255});
     yPos += TILE_SIZE;
+    drawText("Shift + Arrow Key: Run", xPos, yPos, (SDL_Color){255, 255, 255, 255});
+    yPos += TILE_SIZE;
     drawText("r: Rest (recover HP/Mana)", xPos, yPos, (SDL_Color){255, 255, 255, 255});
     yPos += TILE_SIZE;
+    drawText("R: Rest until healed", xPos, yPos, (SDL_Color){255, 255, 255, 255});
+    yPos += TILE_SIZE;
+    drawText("x: Explore, >: Travel to Stairs, Click: Travel", xPos, yPos, (SDL_Color){255, 255, 255, 255});
+    yPos += TILE_SIZE;
     drawText("h: Cast Healing Spell", xPos, yPos, (SDL_Color){255, 255, 255, 255});
     yPos += TILE_SIZE;
     drawText("f + Arrow Key: Cast Magic Missile", xPos, yPos, (SDL_Color){255, 255, 255, 255});
@@ -1134,6 +846,12 @@ void renderHelpScreen() {
     yPos += TILE_SIZE;
     drawText("e: Eat Food", xPos, yPos, (SDL_Color){255, 255, 255, 255});
     yPos += TILE_SIZE;
+    drawText("s: Save Game", xPos, yPos, (SDL_Color){255, 255, 255, 255});
+    yPos += TILE_SIZE;
+    drawText("l: Load Saved Game", xPos, yPos, (SDL_Color){255, 255, 255, 255});
+    yPos += TILE_SIZE;
+    drawText("PgUp/PgDn: Message History", xPos, yPos, (SDL_Color){255, 255, 255, 255});
+    yPos += TILE_SIZE;
     drawText("?: Show Help (this screen)", xPos, yPos, (SDL_Color){255, 255, 255, 255});
     yPos += TILE_SIZE * 2;
     drawText("Press ESC to return to the game", xPos, yPos, (SDL_Color){255, 255, 255, 255});
@@ -1155,7 +873,7 @@ void renderWinScreen() {
     char scoreMessage[100];
     snprintf(scoreMessage, sizeof(scoreMessage), "Final Score: %d", player.score);
     int scoreMessageWidth;
-    TTF_SizeText(font, scoreMessage, &scoreMessageWidth, NULL);
+    sizeText(scoreMessage, &scoreMessageWidth, NULL);
     drawText(scoreMessage, (SCREEN_WIDTH - scoreMessageWidth) / 2, yPos, (SDL_Color){255, 255, 255, 255});
     
     SDL_RenderPresent(renderer);
@@ -1171,50 +889,58 @@ void renderLevelUpScreen() {
     char message[100];
     snprintf(message, sizeof(message), "Welcome to Level %d!", player.level);
     int messageWidth;
-    TTF_SizeText(font, message, &messageWidth, NULL);
+    sizeText(message, &messageWidth, NULL);
     drawText(message, (SCREEN_WIDTH - messageWidth) / 2, SCREEN_HEIGHT / 2, (SDL_Color){0, 255, 0, 255});
     SDL_RenderPresent(renderer);
 }
 
 // A helper function to draw text to the screen
 void drawText(const char* text, int x, int y, SDL_Color color) {
-    if (font == NULL) return;
-    SDL_Surface* textSurface = TTF_RenderText_Solid(font, text, color);
+    TRACE_SCOPE("drawText");
+    SDL_Surface* textSurface = renderText(text, color);
     if (textSurface != NULL) {
         SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
         SDL_Rect renderQuad = {x, y, textSurface->w, textSurface->h};
         SDL_RenderCopy(renderer, textTexture, NULL, &renderQuad);
+        perfTextureUploads++;
+        perfDrawCalls++;
         SDL_FreeSurface(textSurface);
         SDL_DestroyTexture(textTexture);
     }
 }
 
-// Function to display a message to the player
-void showMessage(const char* message) {
-    strncpy(messageBuffer, message, sizeof(messageBuffer) - 1);
-    messageBuffer[sizeof(messageBuffer) - 1] = '\0';
-    messageTimer = 2; // Set timer to 2 so it stays for 1 turn after the current one
-}
-
-// Simple Manhattan distance calculation
-int getDistance(int x1, int y1, int x2, int y2) {
-    return abs(x1 - x2) + abs(y1 - y2);
-}
-
-// Check if a tile is occupied by a monster
-int isOccupiedByMonster(int x, int y) {
-    for (int i = 0; i < MAX_MONSTERS; i++) {
-        if (monsters[i].active && monsters[i].x == x && monsters[i].y == y) {
-            return i;
-        }
+// Like drawText, but the texture is made once and kept in `cached` until
+// the text or color changes. Returns the width drawn.
+int drawCachedText(CachedText* cached, const char* text, int x, int y, SDL_Color color) {
+    if (!cached->valid || strcmp(cached->text, text) != 0 ||
+        cached->color.r != color.r || cached->color.g != color.g || cached->color.b != color.b) {
+        TRACE_SCOPE("drawCachedText");
+        freeCachedText(cached);
+        snprintf(cached->text, sizeof(cached->text), "%s", text);
+        cached->color = color;
+        cached->valid = 1;
+        SDL_Surface* textSurface = renderText(cached->text, color);
+        if (textSurface != NULL) {
+            cached->texture = SDL_CreateTextureFromSurface(renderer, textSurface);
+            cached->width = textSurface->w;
+            cached->height = textSurface->h;
+            perfTextureUploads++;
+            SDL_FreeSurface(textSurface);
+        }
+    }
+    if (cached->texture != NULL) {
+        SDL_Rect renderQuad = {x, y, cached->width, cached->height};
+        SDL_RenderCopy(renderer, cached->texture, NULL, &renderQuad);
+        perfDrawCalls++;
+        return cached->width;
     }
-    return -1;
+    return 0;
 }
 
-// Check if a tile is walkable (not a wall)
-int isTileWalkable(int x, int y) {
-    if (x >= 0 && x < MAP_WIDTH && y >= 0 && y < MAP_HEIGHT && map[y][x] != '#') {
-        return 1;
+void freeCachedText(CachedText* cached) {
+    if (cached->texture != NULL) {
+        SDL_DestroyTexture(cached->texture);
     }
-    return 0;
+    cached->texture = NULL;
+    cached->valid = 0;
 }
@@ -0,0 +1,96 @@
+// Build step: compress asset files with lz.c and write them as a C
+// source file of their own, compiled once into the game. See assets.h.
+//
+// Usage: packassets output.c [asset-file]...
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assets.h"
+#include "lz.h"
+
+// The file's contents, or NULL with a message; *size is set on success
+static unsigned char* readFile(const char* path, size_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("Could not open %s\n", path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    unsigned char* data = malloc(length > 0 ? (size_t)length : 1);
+    if (length < 0 || data == NULL || fread(data, 1, (size_t)length, file) != (size_t)length) {
+        printf("Could not read %s\n", path);
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    *size = (size_t)length;
+    return data;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printf("Usage: %s output.c [asset-file]...\n", argv[0]);
+        return 1;
+    }
+    int count = argc - 2;
+    if (count > MAX_ASSETS) {
+        printf("%d assets given, but the game takes at most %d (MAX_ASSETS)\n", count, MAX_ASSETS);
+        return 1;
+    }
+    FILE* out = fopen(argv[1], "w");
+    if (out == NULL) {
+        printf("Could not open %s for writing\n", argv[1]);
+        return 1;
+    }
+    fprintf(out, "// Generated by packassets; do not edit\n#include \"assets.h\"\n");
+
+    size_t* packedSizes = calloc(count > 0 ? count : 1, sizeof(size_t));
+    size_t* rawSizes = calloc(count > 0 ? count : 1, sizeof(size_t));
+    size_t totalRaw = 0, totalPacked = 0;
+    for (int i = 0; i < count; i++) {
+        unsigned char* raw = readFile(argv[i + 2], &rawSizes[i]);
+        if (raw == NULL) return 1;
+        size_t capacity = lzCompressBound(rawSizes[i]);
+        unsigned char* packed = malloc(capacity);
+        if (packed == NULL || (packedSizes[i] = lzCompress(raw, rawSizes[i], packed, capacity)) == 0) {
+            printf("Could not compress %s\n", argv[i + 2]);
+            return 1;
+        }
+
+        fprintf(out, "\nstatic const unsigned char asset%d[] = {", i);
+        for (size_t j = 0; j < packedSizes[i]; j++) {
+            fprintf(out, "%s%u,", j % 24 == 0 ? "\n" : "", packed[j]);
+        }
+        fprintf(out, "\n};\n");
+        totalRaw += rawSizes[i];
+        totalPacked += packedSizes[i];
+        free(packed);
+        free(raw);
+    }
+
+    // Assets are decompressed back to back into one pool
+    fprintf(out, "\nconst PackedAsset packedAssets[] = {\n");
+    size_t offset = 0;
+    for (int i = 0; i < count; i++) {
+        const char* name = strrchr(argv[i + 2], '/');
+        name = name != NULL ? name + 1 : argv[i + 2];
+        fprintf(out, "    {\"%s\", asset%d, %zu, %zu, %zu},\n", name, i, packedSizes[i], rawSizes[i], offset);
+        offset += rawSizes[i];
+    }
+    if (count == 0) {
+        fprintf(out, "    {0},\n"); // C has no empty arrays
+    }
+    fprintf(out, "};\nconst int packedAssetCount = %d;\nconst size_t assetPoolSize = %zu;\n", count, totalRaw);
+
+    free(packedSizes);
+    free(rawSizes);
+    if (fclose(out) != 0) {
+        printf("Could not write %s\n", argv[1]);
+        return 1;
+    }
+    printf("Packed %d assets: %zu bytes into %zu\n", count, totalRaw, totalPacked);
+    return 0;
+}
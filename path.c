@@ -0,0 +1,122 @@
+#include <string.h>
+#include "path.h"
+
+#define PATH_TILES (MAP_WIDTH * MAP_HEIGHT)
+
+const int pathDirX[4] = {0, 0, -1, 1};
+const int pathDirY[4] = {-1, 1, 0, 0};
+
+// A tile has been reached in the current search when its stamp equals
+// searchStamp, so starting a search never has to clear the arrays
+static _Thread_local unsigned int visitStamp[PATH_TILES];
+static _Thread_local unsigned int searchStamp = 0;
+static _Thread_local unsigned char firstStep[PATH_TILES]; // Direction of the first step on the way here
+static _Thread_local int queue[PATH_TILES];
+static _Thread_local int depth[PATH_TILES];
+
+int findPath(int x, int y, PathGoal isGoal, void* data, int maxSteps, int* dx, int* dy, int* goalX, int* goalY) {
+    int head = 0;
+    int tail = 0;
+
+    if (++searchStamp == 0) {
+        // The stamp wrapped: forget every old search
+        for (int i = 0; i < PATH_TILES; i++) visitStamp[i] = 0;
+        searchStamp = 1;
+    }
+    *dx = 0;
+    *dy = 0;
+    *goalX = x;
+    *goalY = y;
+    if (isGoal(x, y, data)) return 0;
+
+    int start = y * MAP_WIDTH + x;
+    visitStamp[start] = searchStamp;
+    depth[start] = 0;
+    queue[tail++] = start;
+    while (head < tail) {
+        int current = queue[head++];
+        int cx = current % MAP_WIDTH;
+        int cy = current / MAP_WIDTH;
+        if (maxSteps > 0 && depth[current] >= maxSteps) continue;
+        for (int d = 0; d < 4; d++) {
+            int nx = cx + pathDirX[d];
+            int ny = cy + pathDirY[d];
+            if (nx < 0 || nx >= MAP_WIDTH || ny < 0 || ny >= MAP_HEIGHT || map[ny][nx] == '#') continue;
+            int next = ny * MAP_WIDTH + nx;
+            if (visitStamp[next] == searchStamp) continue;
+            visitStamp[next] = searchStamp;
+            depth[next] = depth[current] + 1;
+            firstStep[next] = current == start ? (unsigned char)d : firstStep[current];
+            if (isGoal(nx, ny, data)) {
+                *dx = pathDirX[firstStep[next]];
+                *dy = pathDirY[firstStep[next]];
+                *goalX = nx;
+                *goalY = ny;
+                return depth[next];
+            }
+            if (map[ny][nx] == '>') continue; // Would take the walker down a level
+            queue[tail++] = next;
+        }
+    }
+    return -1;
+}
+
+void buildDistanceMap(DistanceMap* distances, PathGoal isGoal, void* data) {
+    int head = 0;
+    int tail = 0;
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            if (visibility[y][x] && map[y][x] != '#' && isGoal(x, y, data)) {
+                distances->distance[y][x] = 0;
+                queue[tail++] = y * MAP_WIDTH + x;
+            } else {
+                distances->distance[y][x] = PATH_UNREACHABLE;
+            }
+        }
+    }
+    while (head < tail) {
+        int current = queue[head++];
+        int cx = current % MAP_WIDTH;
+        int cy = current / MAP_WIDTH;
+        unsigned short next = distances->distance[cy][cx] + 1;
+        for (int d = 0; d < 4; d++) {
+            int nx = cx + pathDirX[d];
+            int ny = cy + pathDirY[d];
+            if (nx < 0 || nx >= MAP_WIDTH || ny < 0 || ny >= MAP_HEIGHT || map[ny][nx] == '#' || map[ny][nx] == '>' ||
+                !visibility[ny][nx] || distances->distance[ny][nx] != PATH_UNREACHABLE) {
+                continue;
+            }
+            distances->distance[ny][nx] = next;
+            queue[tail++] = ny * MAP_WIDTH + nx;
+        }
+    }
+    distances->mapVersion = mapVersion;
+    distances->valid = 1;
+}
+
+int stepDownhill(const DistanceMap* distances, int x, int y, int* dx, int* dy) {
+    int here = distances->distance[y][x];
+    *dx = 0;
+    *dy = 0;
+    if (here == PATH_UNREACHABLE) return -1;
+    for (int d = 0; d < 4 && here > 0; d++) {
+        int nx = x + pathDirX[d];
+        int ny = y + pathDirY[d];
+        if (nx >= 0 && nx < MAP_WIDTH && ny >= 0 && ny < MAP_HEIGHT && distances->distance[ny][nx] == here - 1) {
+            *dx = pathDirX[d];
+            *dy = pathDirY[d];
+            break;
+        }
+    }
+    return here;
+}
+
+int findKnownStairs(int* target) {
+    // A level has at most one staircase, so this is a byte scan
+    const char* tile = memchr(map, '>', sizeof(map));
+    if (tile == NULL) return 0;
+    int index = (int)(tile - &map[0][0]);
+    target[0] = index % MAP_WIDTH;
+    target[1] = index / MAP_WIDTH;
+    return visibility[target[1]][target[0]];
+}
@@ -0,0 +1,46 @@
+#ifndef PATH_H
+#define PATH_H
+
+#include "game.h"
+
+// The four steps a search takes from a tile: up, down, left, right
+extern const int pathDirX[4];
+extern const int pathDirY[4];
+
+// Accepts or rejects a tile as the destination of a search
+typedef int (*PathGoal)(int x, int y, void* data);
+
+// Breadth-first search over walkable tiles from (x, y) to the nearest
+// tile accepted by `isGoal`, giving up after `maxSteps` (0 for no
+// limit). Monsters don't block: walking into one attacks it. The stairs
+// are never crossed, as stepping on them descends, but can be the goal.
+// Returns the number of steps, or -1 if no goal is reachable, and stores
+// the first step in *dx, *dy and the goal in *goalX, *goalY.
+int findPath(int x, int y, PathGoal isGoal, void* data, int maxSteps, int* dx, int* dy, int* goalX, int* goalY);
+
+#define PATH_UNREACHABLE 0xFFFF
+
+// Steps from every tile to the nearest goal, from one breadth-first
+// search spreading out from all the goals at once. Walking downhill leads
+// to a goal from anywhere, so a multi-turn walk searches once and then
+// only looks up each step, until mapVersion says the map has changed.
+// Only explored tiles are crossed, as the player can't plan through what
+// they haven't seen, and never the stairs, which would end the walk on a
+// new level. The stairs can still be a goal.
+typedef struct {
+    unsigned short distance[MAP_HEIGHT][MAP_WIDTH]; // PATH_UNREACHABLE where no goal can be reached
+    unsigned int mapVersion; // Of the map it was built from
+    int valid;
+} DistanceMap;
+
+void buildDistanceMap(DistanceMap* distances, PathGoal isGoal, void* data);
+
+// The step from (x, y) towards the nearest goal. Returns the distance
+// from (x, y), or -1 if no goal can be reached.
+int stepDownhill(const DistanceMap* distances, int x, int y, int* dx, int* dy);
+
+// Store where the stairs are in target[0], target[1]. Returns 1 if the
+// player has seen them, 0 if not or if the level has none.
+int findKnownStairs(int* target);
+
+#endif // PATH_H
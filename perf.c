@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "game.h"
+#include "perf.h"
+#include "text.h"
+
+#define ATLAS_FIRST ' '
+#define ATLAS_LAST '~'
+#define ATLAS_GLYPHS (ATLAS_LAST - ATLAS_FIRST + 1)
+#define OVERLAY_LINES 2
+#define OVERLAY_PADDING 4
+
+int perfOverlayVisible = 0;
+int perfDrawCalls = 0;
+int perfTextureUploads = 0;
+
+// Rolling sample windows, in milliseconds
+typedef struct {
+    double samples[PERF_WINDOW];
+    int count;
+    int next;
+} SampleWindow;
+
+static SampleWindow frameTimes;
+static SampleWindow turnTimes;
+static double sortScratch[PERF_WINDOW];
+
+static Uint64 lastFrameStart = 0;
+static int lastDrawCalls = 0;      // Counts for the last finished frame
+static int lastTextureUploads = 0;
+static long long residentBytes = -1; // -1 if unknown
+static Uint32 lastRssSample = 0;
+
+static SDL_Renderer* overlayRenderer = NULL;
+static SDL_Texture* atlas = NULL;
+static int glyphWidth = 0;
+static int glyphHeight = 0;
+
+static void addSample(SampleWindow* window, double value) {
+    window->samples[window->next] = value;
+    window->next = (window->next + 1) % PERF_WINDOW;
+    if (window->count < PERF_WINDOW) window->count++;
+}
+
+static int compareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Average and 99th percentile of a window, sorted in a static scratch copy
+static void summarize(const SampleWindow* window, double* average, double* p99) {
+    *average = 0.0;
+    *p99 = 0.0;
+    if (window->count == 0) return;
+    double sum = 0.0;
+    for (int i = 0; i < window->count; i++) {
+        sortScratch[i] = window->samples[i];
+        sum += window->samples[i];
+    }
+    qsort(sortScratch, window->count, sizeof(double), compareDoubles);
+    *average = sum / window->count;
+    *p99 = sortScratch[(window->count * 99 + 99) / 100 - 1];
+}
+
+// Resident set size of this process in bytes, or -1 if unavailable
+static long long readResidentBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return -1;
+    return (long long)counters.WorkingSetSize;
+#else
+    // statm holds sizes in pages: total, then resident. Plain read() into a
+    // stack buffer, because stdio would allocate a FILE every sample.
+    char buffer[128];
+    int fd = open("/proc/self/statm", O_RDONLY);
+    if (fd < 0) return -1;
+    ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (length <= 0) return -1;
+    buffer[length] = '\0';
+    long long totalPages, residentPages;
+    if (sscanf(buffer, "%lld %lld", &totalPages, &residentPages) != 2) return -1;
+    return residentPages * sysconf(_SC_PAGESIZE);
+#endif
+}
+
+int initPerfOverlay(SDL_Renderer* renderer) {
+    overlayRenderer = renderer;
+    sizeText("M", &glyphWidth, &glyphHeight);
+
+    // One row of white glyphs; colour comes from the texture's colour mod
+    char glyphs[ATLAS_GLYPHS + 1];
+    for (int c = ATLAS_FIRST; c <= ATLAS_LAST; c++) {
+        glyphs[c - ATLAS_FIRST] = (char)c;
+    }
+    glyphs[ATLAS_GLYPHS] = '\0';
+    SDL_Surface* sheet = renderText(glyphs, (SDL_Color){255, 255, 255, 255});
+    if (sheet == NULL) {
+        printf("Could not create the overlay glyph sheet: %s\n", SDL_GetError());
+        return -1;
+    }
+    atlas = SDL_CreateTextureFromSurface(renderer, sheet);
+    SDL_FreeSurface(sheet);
+    if (atlas == NULL) {
+        printf("Could not create the overlay glyph atlas: %s\n", SDL_GetError());
+        return -1;
+    }
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+    return 0;
+}
+
+void closePerfOverlay() {
+    if (atlas != NULL) {
+        SDL_DestroyTexture(atlas);
+        atlas = NULL;
+    }
+}
+
+void beginPerfFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (lastFrameStart != 0) {
+        addSample(&frameTimes, (now - lastFrameStart) * 1000.0 / SDL_GetPerformanceFrequency());
+    }
+    lastFrameStart = now;
+    lastDrawCalls = perfDrawCalls;
+    lastTextureUploads = perfTextureUploads;
+    perfDrawCalls = 0;
+    perfTextureUploads = 0;
+
+    if (perfOverlayVisible && (residentBytes == -1 || SDL_GetTicks() - lastRssSample >= PERF_RSS_INTERVAL)) {
+        residentBytes = readResidentBytes();
+        lastRssSample = SDL_GetTicks();
+    }
+}
+
+void addTurnSample(Uint64 ticks) {
+    addSample(&turnTimes, ticks * 1000.0 / SDL_GetPerformanceFrequency());
+}
+
+static void drawAtlasText(const char* text, int x, int y) {
+    for (const char* c = text; *c != '\0'; c++, x += glyphWidth) {
+        if (*c < ATLAS_FIRST || *c > ATLAS_LAST || *c == ' ') continue;
+        SDL_Rect source = {(*c - ATLAS_FIRST) * glyphWidth, 0, glyphWidth, glyphHeight};
+        SDL_Rect target = {x, y, glyphWidth, glyphHeight};
+        SDL_RenderCopy(overlayRenderer, atlas, &source, &target);
+        perfDrawCalls++;
+    }
+}
+
+int renderPerfOverlay(int x, int y) {
+    static char lines[OVERLAY_LINES][128];
+    if (!perfOverlayVisible || atlas == NULL) return 1;
+
+    double frameAverage, frameP99, turnAverage, turnP99;
+    summarize(&frameTimes, &frameAverage, &frameP99);
+    summarize(&turnTimes, &turnAverage, &turnP99);
+    int liveMonsters = 0;
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        liveMonsters += monsters[i].active;
+    }
+
+    snprintf(lines[0], sizeof(lines[0]), "Frame %.2f ms avg %.2f p99 | Turn %.3f ms avg %.3f p99",
+             frameAverage, frameP99, turnAverage, turnP99);
+    if (residentBytes >= 0) {
+        snprintf(lines[1], sizeof(lines[1]), "Draws %d | Uploads %d | Monsters %d | RSS %.1f MB",
+                 lastDrawCalls, lastTextureUploads, liveMonsters, residentBytes / (1024.0 * 1024.0));
+    } else {
+        snprintf(lines[1], sizeof(lines[1]), "Draws %d | Uploads %d | Monsters %d | RSS n/a",
+                 lastDrawCalls, lastTextureUploads, liveMonsters);
+    }
+
+    // Dim the map behind the text so it stays readable
+    int widest = 0;
+    for (int i = 0; i < OVERLAY_LINES; i++) {
+        int length = (int)strlen(lines[i]);
+        if (length > widest) widest = length;
+    }
+    SDL_Rect background = {x, y, widest * glyphWidth + 2 * OVERLAY_PADDING,
+                           OVERLAY_LINES * glyphHeight + 2 * OVERLAY_PADDING};
+    int screenWidth = 0;
+    if (SDL_GetRendererOutputSize(overlayRenderer, &screenWidth, NULL) == 0 && x + background.w > screenWidth) {
+        return 0;
+    }
+    SDL_SetRenderDrawBlendMode(overlayRenderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(overlayRenderer, 0, 0, 0, 192);
+    SDL_RenderFillRect(overlayRenderer, &background);
+    SDL_SetRenderDrawBlendMode(overlayRenderer, SDL_BLENDMODE_NONE);
+    perfDrawCalls++;
+
+    SDL_SetTextureColorMod(atlas, 255, 255, 0);
+    for (int i = 0; i < OVERLAY_LINES; i++) {
+        drawAtlasText(lines[i], x + OVERLAY_PADDING, y + OVERLAY_PADDING + i * glyphHeight);
+    }
+    return 1;
+}
@@ -0,0 +1,33 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <SDL2/SDL.h>
+
+#define PERF_WINDOW 240 // Frames and turns in the rolling sample window
+#define PERF_RSS_INTERVAL 500 // Milliseconds between resident memory samples
+
+// Performance overlay: frame and turn times over a rolling window, draw
+// calls and texture uploads per frame, live monsters and resident memory.
+// The text is drawn from a glyph atlas built once at startup, so showing
+// the overlay doesn't allocate or upload anything.
+
+extern int perfOverlayVisible;
+extern int perfDrawCalls;      // This frame so far
+extern int perfTextureUploads; // This frame so far
+
+// Build the glyph atlas. Returns 0 on success, -1 if it couldn't be made,
+// in which case the overlay stays blank.
+int initPerfOverlay(SDL_Renderer* renderer);
+void closePerfOverlay();
+
+// Call once at the top of every frame: closes the previous frame's sample
+void beginPerfFrame();
+
+// Add the time one turn took to process, in performance counter ticks
+void addTurnSample(Uint64 ticks);
+
+// Draw the overlay with its top-left corner at (x, y). Returns 0, and
+// draws nothing, if it would run off the right edge of the screen.
+int renderPerfOverlay(int x, int y);
+
+#endif // PERF_H
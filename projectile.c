@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "projectile.h"
+#include "trace.h"
+
+// The tiles a shot crosses to get from one tile to another
+// PROJECTILE_RANGE or fewer tiles away along each axis, ending on the
+// target, and the symbol it is drawn with
+typedef struct {
+    int length;
+    signed char step[PROJECTILE_RANGE][2];
+    char symbol;
+} Ray;
+
+typedef struct {
+    int monsterIndex;
+    int x, y;       // Where it was fired from
+    const Ray* ray;
+    int flight;     // Tiles flown before hitting something
+    int damage;     // 0 if it missed the player
+} Projectile;
+
+#define RAY_SPAN (2 * PROJECTILE_RANGE + 1)
+
+// Indexed by [dy + PROJECTILE_RANGE][dx + PROJECTILE_RANGE]
+static _Thread_local Ray rays[RAY_SPAN][RAY_SPAN];
+static _Thread_local int raysBuilt = 0;
+
+static _Thread_local Projectile projectiles[MAX_PROJECTILES];
+static _Thread_local int numProjectiles = 0;
+
+// Bresenham's line from (0, 0) to every offset in range
+static void buildRays() {
+    for (int dy = -PROJECTILE_RANGE; dy <= PROJECTILE_RANGE; dy++) {
+        for (int dx = -PROJECTILE_RANGE; dx <= PROJECTILE_RANGE; dx++) {
+            Ray* ray = &rays[dy + PROJECTILE_RANGE][dx + PROJECTILE_RANGE];
+            int stepX = dx > 0 ? 1 : -1;
+            int stepY = dy > 0 ? 1 : -1;
+            int error = abs(dx) - abs(dy);
+            int x = 0, y = 0;
+            ray->length = 0;
+            while (x != dx || y != dy) {
+                int twice = 2 * error;
+                if (twice > -abs(dy)) { error -= abs(dy); x += stepX; }
+                if (twice < abs(dx)) { error += abs(dx); y += stepY; }
+                ray->step[ray->length][0] = (signed char)x;
+                ray->step[ray->length][1] = (signed char)y;
+                ray->length++;
+            }
+
+            if (abs(dx) > 2 * abs(dy)) {
+                ray->symbol = '-';
+            } else if (abs(dy) > 2 * abs(dx)) {
+                ray->symbol = '|';
+            } else {
+                ray->symbol = (dx > 0) == (dy > 0) ? '\\' : '/';
+            }
+        }
+    }
+    raysBuilt = 1;
+}
+
+// How far along the ray a shot gets before a wall or a monster stops it
+static int flightLength(int x, int y, const Ray* ray) {
+    for (int i = 0; i < ray->length - 1; i++) {
+        int tileX = x + ray->step[i][0];
+        int tileY = y + ray->step[i][1];
+        if (map[tileY][tileX] == '#' || isOccupiedByMonster(tileX, tileY) != -1) return i;
+    }
+    return ray->length;
+}
+
+int fireProjectile(int monsterIndex) {
+    Monster* monster = &monsters[monsterIndex];
+    int dx = player.x - monster->x;
+    int dy = player.y - monster->y;
+    int distance = getDistance(monster->x, monster->y, player.x, player.y);
+    if (!monster->rangedAttack || distance <= 1 || distance > PROJECTILE_RANGE || numProjectiles >= MAX_PROJECTILES) {
+        return 0;
+    }
+
+    if (!raysBuilt) buildRays();
+    const Ray* ray = &rays[dy + PROJECTILE_RANGE][dx + PROJECTILE_RANGE];
+    if (flightLength(monster->x, monster->y, ray) < ray->length) return 0;
+
+    // Half the time the monster closes in instead
+    if (gameRand() % 2 != 0) return 0;
+
+    Projectile* shot = &projectiles[numProjectiles++];
+    shot->monsterIndex = monsterIndex;
+    shot->x = monster->x;
+    shot->y = monster->y;
+    shot->ray = ray;
+    return 1;
+}
+
+void resolveProjectiles() {
+    TRACE_SCOPE("resolveProjectiles");
+    if (numProjectiles == 0) return;
+
+    // Monsters that moved after a shot was fired can still get in its way
+    int hits = 0, totalDamage = 0, longestFlight = 0;
+    const char* shooter = NULL;
+    for (int i = 0; i < numProjectiles; i++) {
+        Projectile* shot = &projectiles[i];
+        shot->flight = flightLength(shot->x, shot->y, shot->ray);
+        shot->damage = 0;
+        if (shot->flight == shot->ray->length) {
+            shot->damage = gameRand() % (3 + dungeonLevel) + 1; // Weaker than a blow: 1-3 + dungeon level
+            hits++;
+            totalDamage += shot->damage;
+            shooter = monsters[shot->monsterIndex].name;
+        }
+        if (shot->flight > longestFlight) longestFlight = shot->flight;
+    }
+
+    // One frame per tile flown, holding every shot still in the air
+    int frame = nextEffectFrame();
+    for (int step = 0; step < longestFlight; step++, frame++) {
+        for (int i = 0; i < numProjectiles; i++) {
+            const Projectile* shot = &projectiles[i];
+            if (step >= shot->flight) continue;
+            queueEffect(frame, shot->x + shot->ray->step[step][0], shot->y + shot->ray->step[step][1], shot->ray->symbol);
+        }
+    }
+
+    if (hits > 0) {
+        char tempBuffer[256];
+        int wasAlive = player.hp > 0;
+        player.hp -= totalDamage;
+        pendingSounds |= SOUND_HIT;
+        if (wasAlive && player.hp <= 0) {
+            strncpy(player.causeOfDeath, shooter, sizeof(player.causeOfDeath) - 1);
+            player.causeOfDeath[sizeof(player.causeOfDeath) - 1] = '\0';
+        }
+        if (hits == 1) {
+            snprintf(tempBuffer, sizeof(tempBuffer), "The %s's bolt hits you for %d damage! Your HP is now %d/%d.", shooter, totalDamage, player.hp, player.maxHp);
+        } else {
+            snprintf(tempBuffer, sizeof(tempBuffer), "%d bolts hit you for %d damage! Your HP is now %d/%d.", hits, totalDamage, player.hp, player.maxHp);
+        }
+        showMessage(tempBuffer);
+    }
+    numProjectiles = 0;
+}
@@ -0,0 +1,27 @@
+#ifndef PROJECTILE_H
+#define PROJECTILE_H
+
+#include "game.h"
+
+// Monster projectiles. Monsters with rangedAttack shoot at a player they
+// can see instead of walking up to them. Every shot follows a ray looked
+// up from a table built once per thread, so aiming is a walk along a
+// handful of precomputed offsets. Shots fired during a turn are only
+// resolved afterwards, all in one pass: hits are added up into one
+// message, and the flight of every shot is queued on the effect queue
+// with the shots in the air at the same time sharing a frame.
+//
+//   for each monster:  if (!fireProjectile(i)) walk;
+//   resolveProjectiles();
+
+#define PROJECTILE_RANGE MONSTER_DETECTION_RANGE
+#define MAX_PROJECTILES MAX_MONSTERS
+
+// Queues a shot from the monster at the player if nothing is in the way.
+// Returns 1 if it fired, which uses up the monster's turn.
+int fireProjectile(int monsterIndex);
+
+// Flies the shots queued this turn and applies their damage
+void resolveProjectiles();
+
+#endif // PROJECTILE_H
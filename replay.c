@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lz.h"
+#include "replay.h"
+#include "save.h"
+
+// Directions of ACTION_MOVE and ACTION_MISSILE, by their index in a record
+static const int directionX[4] = {0, 0, -1, 1};
+static const int directionY[4] = {-1, 1, 0, 0};
+
+static FILE* recording = NULL;
+static long recordedActions = 0;
+static uint64_t recordedChecksum = 0;
+
+static unsigned char encodeAction(Action action) {
+    int direction = 0;
+    for (int i = 0; i < 4; i++) {
+        if (action.dx == directionX[i] && action.dy == directionY[i]) direction = i;
+    }
+    return (unsigned char)(action.type | direction << 4);
+}
+
+static Action decodeAction(unsigned char record) {
+    Action action;
+    action.type = (ActionType)(record & 0x0F);
+    action.dx = 0;
+    action.dy = 0;
+    if (action.type == ACTION_MOVE || action.type == ACTION_MISSILE) {
+        action.dx = directionX[(record >> 4) & 3];
+        action.dy = directionY[(record >> 4) & 3];
+    }
+    return action;
+}
+
+int startRecording(const char* path) {
+    static SaveSnapshot snapshot;
+    static unsigned char compressed[sizeof(SaveSnapshot) + sizeof(SaveSnapshot) / 255 + 16];
+    ReplayHeader header;
+
+    stopRecording();
+    captureSnapshot(&snapshot);
+    size_t size = lzCompress((const unsigned char*)&snapshot, sizeof(snapshot), compressed, sizeof(compressed));
+    if (size == 0) {
+        printf("Failed to compress the replay snapshot\n");
+        return -1;
+    }
+
+    recording = fopen(path, "wb");
+    if (recording == NULL) {
+        printf("Could not open %s for recording\n", path);
+        return -1;
+    }
+    memcpy(header.magic, REPLAY_MAGIC, 4);
+    header.version = REPLAY_VERSION;
+    header.snapshotSize = sizeof(SaveSnapshot);
+    header.compressedSize = (uint32_t)size;
+    header.checksumInterval = REPLAY_CHECKSUM_INTERVAL;
+    header.reserved = 0;
+    recordedActions = 0;
+    recordedChecksum = 0;
+    if (fwrite(&header, sizeof(header), 1, recording) != 1 ||
+        fwrite(compressed, size, 1, recording) != 1 || fflush(recording) != 0) {
+        printf("Failed to write replay %s\n", path);
+        stopRecording();
+        return -1;
+    }
+    return 0;
+}
+
+void recordAction(Action action) {
+    if (recording == NULL) return;
+    fputc(encodeAction(action), recording);
+    fflush(recording);
+}
+
+void recordTurnEnd() {
+    if (recording == NULL) return;
+    recordedActions++;
+    if (recordedActions % REPLAY_CHECKSUM_INTERVAL != 0) return;
+    recordedChecksum = hashGameState(recordedChecksum);
+    unsigned char record[9];
+    record[0] = REPLAY_CHECKSUM_RECORD;
+    for (int i = 0; i < 8; i++) {
+        record[1 + i] = (unsigned char)(recordedChecksum >> (i * 8));
+    }
+    fwrite(record, sizeof(record), 1, recording);
+    fflush(recording);
+}
+
+void stopRecording() {
+    if (recording == NULL) return;
+    fclose(recording);
+    recording = NULL;
+}
+
+int openReplay(const char* path, Replay* replay) {
+    static SaveSnapshot snapshot;
+    ReplayHeader header;
+
+    memset(replay, 0, sizeof(*replay));
+    FILE* in = fopen(path, "rb");
+    if (in == NULL) {
+        printf("Could not open replay %s\n", path);
+        return -1;
+    }
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    if (size < (long)sizeof(header) || (replay->data = malloc(size)) == NULL ||
+        fread(replay->data, 1, size, in) != (size_t)size) {
+        printf("Could not read replay %s\n", path);
+        fclose(in);
+        closeReplay(replay);
+        return -1;
+    }
+    fclose(in);
+
+    memcpy(&header, replay->data, sizeof(header));
+    if (memcmp(header.magic, REPLAY_MAGIC, 4) != 0 || header.version != REPLAY_VERSION ||
+        header.snapshotSize != sizeof(SaveSnapshot) || header.compressedSize > size - sizeof(header) ||
+        lzDecompress(replay->data + sizeof(header), header.compressedSize,
+                     (unsigned char*)&snapshot, sizeof(snapshot)) != (long)sizeof(snapshot) ||
+        restoreSnapshot(&snapshot) != 0) {
+        printf("Replay %s is damaged or from another version\n", path);
+        closeReplay(replay);
+        return -1;
+    }
+    replay->actions = replay->data + sizeof(header) + header.compressedSize;
+    replay->count = size - (long)(sizeof(header) + header.compressedSize);
+    replay->mismatchAction = -1;
+    gameState = STATE_PLAYING;
+    return 0;
+}
+
+int nextReplayAction(Replay* replay, Action* action) {
+    // Checksums the caller didn't verify are skipped
+    while (replay->next < replay->count && replay->actions[replay->next] == REPLAY_CHECKSUM_RECORD) {
+        replay->next += 9;
+    }
+    if (replay->next >= replay->count) return 0;
+    *action = decodeAction(replay->actions[replay->next++]);
+    replay->actionsRead++;
+    return 1;
+}
+
+int verifyReplayChecksum(Replay* replay) {
+    if (replay->next + 9 > replay->count || replay->actions[replay->next] != REPLAY_CHECKSUM_RECORD) {
+        return 0;
+    }
+    uint64_t recorded = 0;
+    for (int i = 0; i < 8; i++) {
+        recorded |= (uint64_t)replay->actions[replay->next + 1 + i] << (i * 8);
+    }
+    replay->next += 9;
+    replay->checksum = hashGameState(replay->checksum);
+    replay->checksumsVerified++;
+    if (replay->checksum == recorded || replay->mismatchAction >= 0) {
+        return 0;
+    }
+    replay->mismatchAction = replay->actionsRead;
+    replay->recordedChecksum = recorded;
+    return -1;
+}
+
+void closeReplay(Replay* replay) {
+    free(replay->data);
+    memset(replay, 0, sizeof(*replay));
+}
@@ -0,0 +1,57 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "game.h"
+
+#define REPLAY_FILE "dungeonhack.rec"
+#define REPLAY_MAGIC "DHRP"
+#define REPLAY_VERSION 2
+#define REPLAY_CHECKSUM_INTERVAL 100 // Actions between state checksums
+#define REPLAY_CHECKSUM_RECORD 0x0F  // Record type of a checksum
+
+// A replay starts with the compressed snapshot of the game when
+// recording began (which includes the RNG state), followed by one byte
+// per action: the action type in the low four bits, the direction above.
+// Every checksumInterval actions, a REPLAY_CHECKSUM_RECORD byte and the
+// 8-byte rolling hashGameState of the game after that action follow.
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t snapshotSize;   // sizeof(SaveSnapshot)
+    uint32_t compressedSize;
+    uint32_t checksumInterval;
+    uint32_t reserved;
+} ReplayHeader;
+
+typedef struct {
+    unsigned char* data;          // Whole file
+    const unsigned char* actions; // Records after the snapshot
+    long count;
+    long next;
+    long actionsRead;
+    uint64_t checksum;            // Rolling checksum of the replayed game
+    long checksumsVerified;
+    long mismatchAction;          // First action whose checksum differed, -1 if none
+    uint64_t recordedChecksum;    // What the recording had there
+} Replay;
+
+// Start recording the current game to `path`, replacing any recording in
+// progress. Each action is flushed as it is recorded so the file is
+// complete up to the last turn even if the game crashes.
+int startRecording(const char* path);
+void recordAction(Action action); // Before the action is played
+void recordTurnEnd();             // After: appends a checksum when one is due
+void stopRecording();
+
+// Load a replay and restore the game to its starting state. Return 0 on
+// success.
+int openReplay(const char* path, Replay* replay);
+int nextReplayAction(Replay* replay, Action* action); // 0 at the end
+
+// Call after playing each action. If the recording has a checksum
+// there, compare it with the replayed game; returns -1 the first time
+// they differ (see mismatchAction), 0 otherwise.
+int verifyReplayChecksum(Replay* replay);
+void closeReplay(Replay* replay);
+
+#endif // REPLAY_H
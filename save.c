@@ -0,0 +1,462 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "lz.h"
+#include "save.h"
+#include "trace.h"
+
+// Large enough for a compressed save
+#define SAVE_FILE_CAPACITY (sizeof(CompressedSaveHeader) + sizeof(SaveSnapshot) + sizeof(SaveSnapshot) / 255 + 16)
+
+#define PAGE_ROUND(n) (((n) + SAVE_PAGE_SIZE - 1) / SAVE_PAGE_SIZE * SAVE_PAGE_SIZE)
+#define VISIBILITY_STRIDE(width) (((width) + 7) / 8)
+#define MAPPED_SAVE_SIZE (PAGE_ROUND(sizeof(MappedSaveHeader)) + PAGE_ROUND(sizeof(SaveState)) + \
+                          PAGE_ROUND(MAP_WIDTH * MAP_HEIGHT) + \
+                          PAGE_ROUND(VISIBILITY_STRIDE(MAP_WIDTH) * MAP_HEIGHT) + \
+                          PAGE_ROUND(sizeof(Monster) * MAX_MONSTERS))
+
+// Autosave writer state, shared between the game and writer threads
+static pthread_t autosaveThread;
+static pthread_mutex_t autosaveLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t autosaveWake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t autosaveDone = PTHREAD_COND_INITIALIZER;
+static SaveSnapshot autosaveBuffers[2];
+static int autosaveFillIndex = 0; // Buffer the game thread copies into
+static int autosavePending = 0;
+static int autosaveWriting = 0;
+static int autosaveStopping = 0;
+static int autosaveRunning = 0;
+static char autosavePath[256];
+
+static void captureState(SaveState* state) {
+    memset(state, 0, sizeof(*state));
+    state->player = player;
+    memcpy(state->rooms, rooms, sizeof(rooms));
+    state->numRooms = numRooms;
+    state->dungeonLevel = dungeonLevel;
+    state->turnCounter = turnCounter;
+    state->restCounter = restCounter;
+    state->rngState = rngState;
+    state->messageLog = messageLog;
+}
+
+// Saves and replays come from files, so anything used as an index is
+// checked before it is restored
+static int isStateValid(const SaveState* state) {
+    return state->player.x >= 0 && state->player.x < MAP_WIDTH &&
+           state->player.y >= 0 && state->player.y < MAP_HEIGHT &&
+           state->numRooms >= 0 && state->numRooms <= MAX_ROOMS;
+}
+
+static int areMonstersValid(const Monster* list) {
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        if (list[i].active && (list[i].x < 0 || list[i].x >= MAP_WIDTH || list[i].y < 0 || list[i].y >= MAP_HEIGHT)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Strings from a file may be missing their terminator
+static void terminateStrings() {
+    player.causeOfDeath[sizeof(player.causeOfDeath) - 1] = '\0';
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        monsters[i].name[sizeof(monsters[i].name) - 1] = '\0';
+    }
+    for (int i = 0; i < MESSAGE_LOG_SIZE; i++) {
+        messageLog.lines[i][MESSAGE_LENGTH - 1] = '\0';
+    }
+}
+
+static void restoreState(const SaveState* state) {
+    player = state->player;
+    memcpy(rooms, state->rooms, sizeof(rooms));
+    numRooms = state->numRooms;
+    dungeonLevel = state->dungeonLevel;
+    turnCounter = state->turnCounter;
+    restCounter = state->restCounter;
+    rngState = state->rngState;
+    messageLog = state->messageLog;
+    if (messageLog.firstRecent > messageLog.count || messageLog.count - messageLog.firstRecent > MESSAGE_LOG_SIZE) {
+        messageLog.firstRecent = messageLog.count;
+    }
+}
+
+// Region labels are derived data, rebuild them rather than store them.
+// Caches built from the map are rebuilt too, as mapVersion changes.
+static void rebuildRegions() {
+    DungeonGrid grid = {&map[0][0], MAP_WIDTH, MAP_HEIGHT, rooms, numRooms, MAX_ROOMS};
+    labelRegions(&grid, &regionLabels[0][0]);
+    playerRegion = regionLabels[player.y][player.x];
+    mapVersion++;
+}
+
+// Copy the current game state into a snapshot
+void captureSnapshot(SaveSnapshot* snapshot) {
+    memcpy(snapshot->magic, SAVE_MAGIC, 4);
+    snapshot->version = SAVE_VERSION;
+    snapshot->size = sizeof(SaveSnapshot);
+    snapshot->reserved = 0;
+
+    captureState(&snapshot->state);
+    memcpy(snapshot->monsters, monsters, sizeof(monsters));
+    memcpy(snapshot->map, map, sizeof(map));
+    memcpy(snapshot->visibility, visibility, sizeof(visibility));
+}
+
+// Replace the current game state with a snapshot
+int restoreSnapshot(const SaveSnapshot* snapshot) {
+    if (memcmp(snapshot->magic, SAVE_MAGIC, 4) != 0 || snapshot->version != SAVE_VERSION ||
+        snapshot->size != sizeof(SaveSnapshot) || !isStateValid(&snapshot->state) ||
+        !areMonstersValid(snapshot->monsters)) {
+        return -1;
+    }
+
+    restoreState(&snapshot->state);
+    memcpy(monsters, snapshot->monsters, sizeof(monsters));
+    memcpy(map, snapshot->map, sizeof(map));
+    memcpy(visibility, snapshot->visibility, sizeof(visibility));
+    terminateStrings();
+    rebuildRegions();
+    return 0;
+}
+
+// Write `size` bytes to a temporary file, flush it to disk, then rename
+// it over `path` so a crash never leaves a half-written save
+static int replaceFile(const char* path, const void* data, size_t size) {
+    char tempPath[300];
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+    FILE* file = fopen(tempPath, "wb");
+    if (file == NULL) {
+        printf("Could not open %s for writing\n", tempPath);
+        return -1;
+    }
+    int ok = fwrite(data, size, 1, file) == 1 && fflush(file) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(file)) == 0;
+#else
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+    ok = fclose(file) == 0 && ok;
+    if (!ok) {
+        printf("Failed to write save file %s\n", tempPath);
+        remove(tempPath);
+        return -1;
+    }
+
+#ifdef _WIN32
+    ok = MoveFileExA(tempPath, path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    ok = rename(tempPath, path) == 0;
+#endif
+    if (!ok) {
+        printf("Failed to replace save file %s\n", path);
+        remove(tempPath);
+        return -1;
+    }
+    return 0;
+}
+
+// Lay the game out section by section in one page-aligned image and
+// write it with a single call
+int saveGame(const char* path) {
+    static _Thread_local unsigned char image[MAPPED_SAVE_SIZE];
+    MappedSaveHeader header;
+    const uint64_t sizes[SAVE_SECTION_COUNT] = {
+        sizeof(SaveState),
+        MAP_WIDTH * MAP_HEIGHT,
+        VISIBILITY_STRIDE(MAP_WIDTH) * MAP_HEIGHT,
+        sizeof(Monster) * MAX_MONSTERS
+    };
+
+    memset(image, 0, sizeof(image));
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SAVE_MAPPED_MAGIC, 4);
+    header.version = SAVE_VERSION;
+    header.pageSize = SAVE_PAGE_SIZE;
+    header.stateSize = sizeof(SaveState);
+    header.monsterSize = sizeof(Monster);
+    header.width = MAP_WIDTH;
+    header.height = MAP_HEIGHT;
+    header.monsterCount = MAX_MONSTERS;
+    uint64_t offset = PAGE_ROUND(sizeof(MappedSaveHeader));
+    for (int i = 0; i < SAVE_SECTION_COUNT; i++) {
+        header.sections[i].offset = offset;
+        header.sections[i].size = sizes[i];
+        offset += PAGE_ROUND(sizes[i]);
+    }
+    memcpy(image, &header, sizeof(header));
+
+    captureState((SaveState*)(image + header.sections[SECTION_STATE].offset));
+    memcpy(image + header.sections[SECTION_TILES].offset, map, sizeof(map));
+    unsigned char* bits = image + header.sections[SECTION_VISIBILITY].offset;
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        unsigned char* row = bits + y * VISIBILITY_STRIDE(MAP_WIDTH);
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            if (visibility[y][x]) row[x >> 3] |= 1 << (x & 7);
+        }
+    }
+    memcpy(image + header.sections[SECTION_MONSTERS].offset, monsters, sizeof(monsters));
+
+    return replaceFile(path, image, offset);
+}
+
+static void unmapFile(MappedSave* save) {
+#ifdef _WIN32
+    if (save->base != NULL) UnmapViewOfFile(save->base);
+    if (save->mappingHandle != NULL) CloseHandle(save->mappingHandle);
+    if (save->fileHandle != NULL && save->fileHandle != INVALID_HANDLE_VALUE) CloseHandle(save->fileHandle);
+#else
+    if (save->base != NULL) munmap(save->base, save->size);
+#endif
+    memset(save, 0, sizeof(*save));
+}
+
+static int mapFile(const char* path, MappedSave* save) {
+    memset(save, 0, sizeof(*save));
+#ifdef _WIN32
+    LARGE_INTEGER size;
+    save->fileHandle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL, NULL);
+    if (save->fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(save->fileHandle, &size) ||
+        size.QuadPart < (LONGLONG)sizeof(MappedSaveHeader)) {
+        unmapFile(save);
+        return -1;
+    }
+    save->size = (size_t)size.QuadPart;
+    save->mappingHandle = CreateFileMappingA(save->fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (save->mappingHandle != NULL) {
+        save->base = MapViewOfFile(save->mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (save->base == NULL) {
+        unmapFile(save);
+        return -1;
+    }
+#else
+    struct stat info;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(MappedSaveHeader)) {
+        close(fd);
+        return -1;
+    }
+    save->size = (size_t)info.st_size;
+    void* base = mmap(NULL, save->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file open
+    if (base == MAP_FAILED) {
+        save->size = 0;
+        return -1;
+    }
+    save->base = base;
+#endif
+    return 0;
+}
+
+int openMappedSave(const char* path, MappedSave* save) {
+    if (mapFile(path, save) != 0) return -1;
+    const MappedSaveHeader* header = save->base;
+    if (memcmp(header->magic, SAVE_MAPPED_MAGIC, 4) != 0) {
+        unmapFile(save);
+        return -1;
+    }
+
+    uint64_t expected[SAVE_SECTION_COUNT] = {
+        sizeof(SaveState),
+        (uint64_t)header->width * header->height,
+        (uint64_t)VISIBILITY_STRIDE(header->width) * header->height,
+        (uint64_t)sizeof(Monster) * header->monsterCount
+    };
+    int valid = header->version == SAVE_VERSION && header->pageSize == SAVE_PAGE_SIZE &&
+                header->stateSize == sizeof(SaveState) && header->monsterSize == sizeof(Monster);
+    for (int i = 0; valid && i < SAVE_SECTION_COUNT; i++) {
+        const SaveSection* section = &header->sections[i];
+        valid = section->offset % SAVE_PAGE_SIZE == 0 && section->size == expected[i] &&
+                section->offset <= save->size && section->size <= save->size - section->offset;
+    }
+    if (!valid) {
+        unmapFile(save);
+        return -1;
+    }
+
+    const unsigned char* bytes = save->base;
+    save->header = header;
+    save->state = (const SaveState*)(bytes + header->sections[SECTION_STATE].offset);
+    save->tiles = (const char*)(bytes + header->sections[SECTION_TILES].offset);
+    save->visibilityBits = bytes + header->sections[SECTION_VISIBILITY].offset;
+    save->monsters = (const Monster*)(bytes + header->sections[SECTION_MONSTERS].offset);
+    return 0;
+}
+
+void closeMappedSave(MappedSave* save) {
+    unmapFile(save);
+}
+
+int isMappedTileVisible(const MappedSave* save, int x, int y) {
+    const unsigned char* row = save->visibilityBits + (size_t)y * VISIBILITY_STRIDE(save->header->width);
+    return (row[x >> 3] >> (x & 7)) & 1;
+}
+
+// The game's own arrays are fixed-size, so resuming copies out of the
+// mapping; tools reading larger worlds can use the sections in place
+int restoreMappedSave(const MappedSave* save) {
+    if (save->header->width != MAP_WIDTH || save->header->height != MAP_HEIGHT ||
+        save->header->monsterCount != MAX_MONSTERS || !isStateValid(save->state) ||
+        !areMonstersValid(save->monsters)) {
+        return -1;
+    }
+
+    restoreState(save->state);
+    memcpy(map, save->tiles, sizeof(map));
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            visibility[y][x] = isMappedTileVisible(save, x, y);
+        }
+    }
+    memcpy(monsters, save->monsters, sizeof(monsters));
+    terminateStrings();
+    rebuildRegions();
+    return 0;
+}
+
+// Load a game saved by saveGame (mapped) or the autosaver (compressed,
+// read with one read of the whole file)
+int loadGame(const char* path) {
+    static _Thread_local unsigned char file[SAVE_FILE_CAPACITY];
+    static _Thread_local SaveSnapshot unpacked;
+    MappedSave mapped;
+
+    if (openMappedSave(path, &mapped) == 0) {
+        int result = restoreMappedSave(&mapped);
+        closeMappedSave(&mapped);
+        if (result != 0) printf("Save file %s is damaged or from another version\n", path);
+        return result;
+    }
+
+    FILE* in = fopen(path, "rb");
+    if (in == NULL) {
+        return -1;
+    }
+    size_t size = fread(file, 1, sizeof(file), in);
+    fclose(in);
+
+    CompressedSaveHeader header;
+    if (size < sizeof(header) || memcmp(file, SAVE_COMPRESSED_MAGIC, 4) != 0) {
+        // Includes mapped saves that openMappedSave rejected
+        printf("Save file %s is damaged or from another version\n", path);
+        return -1;
+    }
+    memcpy(&header, file, sizeof(header));
+    if (header.version != SAVE_VERSION || header.rawSize != sizeof(SaveSnapshot) ||
+        header.compressedSize > size - sizeof(header) ||
+        lzDecompress(file + sizeof(header), header.compressedSize,
+                     (unsigned char*)&unpacked, sizeof(unpacked)) != (long)sizeof(unpacked) ||
+        restoreSnapshot(&unpacked) != 0) {
+        printf("Save file %s is damaged or from another version\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+int writeCompressedSave(const SaveSnapshot* snapshot, const char* path) {
+    static _Thread_local unsigned char buffer[SAVE_FILE_CAPACITY];
+    CompressedSaveHeader header;
+
+    size_t compressed = lzCompress((const unsigned char*)snapshot, sizeof(*snapshot),
+                                   buffer + sizeof(header), sizeof(buffer) - sizeof(header));
+    if (compressed == 0) {
+        printf("Failed to compress save for %s\n", path);
+        return -1;
+    }
+    memcpy(header.magic, SAVE_COMPRESSED_MAGIC, 4);
+    header.version = SAVE_VERSION;
+    header.rawSize = sizeof(*snapshot);
+    header.compressedSize = (uint32_t)compressed;
+    memcpy(buffer, &header, sizeof(header));
+    return replaceFile(path, buffer, sizeof(header) + compressed);
+}
+
+// Writer thread: take the newest queued snapshot and write it out. The
+// lock is only held to swap buffers, never during compression or I/O.
+static void* autosaveMain(void* unused) {
+    (void)unused;
+    TRACE_THREAD("autosave");
+    pthread_mutex_lock(&autosaveLock);
+    while (1) {
+        while (!autosavePending && !autosaveStopping) {
+            pthread_cond_wait(&autosaveWake, &autosaveLock);
+        }
+        if (!autosavePending) break; // Stopping with nothing left to write
+
+        int writeIndex = autosaveFillIndex;
+        autosaveFillIndex ^= 1;
+        autosavePending = 0;
+        autosaveWriting = 1;
+        pthread_mutex_unlock(&autosaveLock);
+
+        {
+            TRACE_SCOPE("writeCompressedSave");
+            writeCompressedSave(&autosaveBuffers[writeIndex], autosavePath);
+        }
+
+        pthread_mutex_lock(&autosaveLock);
+        autosaveWriting = 0;
+        pthread_cond_broadcast(&autosaveDone);
+    }
+    pthread_mutex_unlock(&autosaveLock);
+    return NULL;
+}
+
+int startAutosave(const char* path) {
+    if (autosaveRunning) return 0;
+    snprintf(autosavePath, sizeof(autosavePath), "%s", path);
+    autosaveStopping = 0;
+    if (pthread_create(&autosaveThread, NULL, autosaveMain, NULL) != 0) {
+        printf("Could not start the autosave thread, saving synchronously\n");
+        return -1;
+    }
+    autosaveRunning = 1;
+    return 0;
+}
+
+void requestAutosave() {
+    if (!autosaveRunning) {
+        // No writer thread: save on this thread instead
+        captureSnapshot(&autosaveBuffers[0]);
+        writeCompressedSave(&autosaveBuffers[0], autosavePath[0] ? autosavePath : SAVE_FILE);
+        return;
+    }
+    pthread_mutex_lock(&autosaveLock);
+    captureSnapshot(&autosaveBuffers[autosaveFillIndex]);
+    autosavePending = 1;
+    pthread_cond_signal(&autosaveWake);
+    pthread_mutex_unlock(&autosaveLock);
+}
+
+void waitForAutosave() {
+    if (!autosaveRunning) return;
+    pthread_mutex_lock(&autosaveLock);
+    while (autosavePending || autosaveWriting) {
+        pthread_cond_wait(&autosaveDone, &autosaveLock);
+    }
+    pthread_mutex_unlock(&autosaveLock);
+}
+
+void stopAutosave() {
+    if (!autosaveRunning) return;
+    pthread_mutex_lock(&autosaveLock);
+    autosaveStopping = 1;
+    pthread_cond_signal(&autosaveWake);
+    pthread_mutex_unlock(&autosaveLock);
+    pthread_join(autosaveThread, NULL); // Writes anything still queued first
+    autosaveRunning = 0;
+}
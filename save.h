@@ -0,0 +1,122 @@
+#ifndef SAVE_H
+#define SAVE_H
+
+#include "game.h"
+
+#define SAVE_FILE "dungeonhack.sav"
+#define SAVE_MAGIC "DHSV"
+#define SAVE_VERSION 4
+#define SAVE_COMPRESSED_MAGIC "DHSZ"
+#define SAVE_MAPPED_MAGIC "DHSM"
+#define SAVE_PAGE_SIZE 4096 // Alignment of every section in a mapped save
+#define AUTOSAVE_INTERVAL 50 // Turns between periodic autosaves
+
+// The small, fixed-size part of the game state
+typedef struct {
+    Player player;
+    Room rooms[MAX_ROOMS];
+    int32_t numRooms;
+    int32_t dungeonLevel;
+    int32_t turnCounter;
+    int32_t restCounter;
+    uint64_t rngState;
+    MessageLog messageLog;
+} SaveState;
+
+// Everything needed to resume a game, laid out exactly as it is written
+// to disk. The header's size field guards against builds whose struct
+// layout differs.
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t size; // sizeof(SaveSnapshot)
+    uint32_t reserved;
+
+    SaveState state;
+    Monster monsters[MAX_MONSTERS];
+    char map[MAP_HEIGHT][MAP_WIDTH];
+    int visibility[MAP_HEIGHT][MAP_WIDTH];
+} SaveSnapshot;
+
+// Header of a compressed save; the LZ-compressed snapshot follows
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t rawSize;
+    uint32_t compressedSize;
+} CompressedSaveHeader;
+
+// Sections of a mapped save. Each starts on a page boundary so the file
+// can be mapped and its tiles, visibility and monsters used in place.
+typedef enum {
+    SECTION_STATE,      // One SaveState
+    SECTION_TILES,      // height rows of width tiles
+    SECTION_VISIBILITY, // height rows of (width + 7) / 8 bytes, one bit per tile
+    SECTION_MONSTERS,   // monsterCount Monsters
+    SAVE_SECTION_COUNT
+} SaveSectionId;
+
+typedef struct {
+    uint64_t offset; // From the start of the file, a multiple of the page size
+    uint64_t size;
+} SaveSection;
+
+// First page of a mapped save
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t pageSize;
+    uint32_t stateSize;   // sizeof(SaveState)
+    uint32_t monsterSize; // sizeof(Monster)
+    uint32_t width;
+    uint32_t height;
+    uint32_t monsterCount;
+    SaveSection sections[SAVE_SECTION_COUNT];
+} MappedSaveHeader;
+
+// A mapped save file. The pointers refer straight into the mapping, so
+// opening costs the same for any world size; pages are read from disk
+// the first time they are touched.
+typedef struct {
+    const MappedSaveHeader* header;
+    const SaveState* state;
+    const char* tiles;
+    const unsigned char* visibilityBits;
+    const Monster* monsters;
+    void* base;
+    size_t size;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+} MappedSave;
+
+void captureSnapshot(SaveSnapshot* snapshot);
+int restoreSnapshot(const SaveSnapshot* snapshot); // 0 on success, -1 if the header doesn't match
+
+// Write the current game state as a mapped save, replacing `path`
+// atomically. loadGame reads both mapped and compressed saves. Return 0
+// on success.
+int saveGame(const char* path);
+int loadGame(const char* path);
+
+// Map a save written by saveGame read-only. Returns -1 without a message
+// if `path` is missing, damaged or not a mapped save.
+int openMappedSave(const char* path, MappedSave* save);
+void closeMappedSave(MappedSave* save);
+int isMappedTileVisible(const MappedSave* save, int x, int y);
+int restoreMappedSave(const MappedSave* save); // Copy into the game state
+
+// Compress a snapshot and replace `path` atomically: write a temporary
+// file, flush it to disk, then rename it over the old save.
+int writeCompressedSave(const SaveSnapshot* snapshot, const char* path);
+
+// Background saving. requestAutosave copies the game state into a spare
+// buffer and returns; a writer thread compresses and writes it. If a
+// save is still being written, newer requests replace the queued one.
+int startAutosave(const char* path);
+void requestAutosave();
+void waitForAutosave(); // Block until queued saves are on disk
+void stopAutosave();
+
+#endif // SAVE_H
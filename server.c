@@ -0,0 +1,1061 @@
+// Game server: hosts many independent games in one process and serves
+// them to terminal clients over TCP or a Unix socket, using the same
+// ANSI screen updates as moria_term. One thread runs an epoll loop that
+// does all socket I/O; a pool of workers plays the turns. Game state
+// lives in thread-local globals, so a worker swaps a session's snapshot
+// in, plays the keys that arrived, renders, and swaps it back out. An
+// idle session costs its snapshot and buffers, and no CPU.
+//
+// With -w, spectators can watch any game: they connect to the watch port
+// and send the game's number and a newline, then receive the frames of
+// spectate.h. A worker encodes each frame once and every viewer is sent
+// the same bytes, so a game with many viewers costs one encode per turn.
+//
+// Usage: moria_server [-p port] [-u socket-path] [-w watch-port] [-j workers] [-size COLSxROWS]
+// Connect with a raw terminal, e.g. socat -,raw,echo=0 tcp:localhost:4000,
+// and watch with moria_term --watch localhost:4001 <game>
+#define _GNU_SOURCE // accept4
+#include <errno.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "save.h"
+#include "spectate.h"
+#include "termui.h"
+#include "workpool.h"
+
+#define SERVER_PORT 4000
+#define SERVER_BACKLOG 1024
+#define SERVER_MAX_EVENTS 256
+#define SERVER_READ_SIZE 1024
+#define SERVER_MAX_INPUT 1024          // Unplayed input kept per session; more is dropped
+#define SERVER_MAX_OUTPUT (256 * 1024) // Unsent output before a client is dropped
+#define SERVER_COLS 80
+#define SERVER_ROWS 24
+#define SPECTATE_KEYFRAME_INTERVAL 64 // Frames between keyframes, where viewers can join
+#define SPECTATE_MAX_LAG 256          // Frames a viewer may fall behind before skipping to a keyframe
+#define SPECTATE_MAX_IOV 64           // Frames sent per writev
+
+typedef enum {
+    SOURCE_LISTENER,
+    SOURCE_WATCH_LISTENER,
+    SOURCE_CLIENT,
+    SOURCE_VIEWER,
+    SOURCE_WAKE
+} EventSourceType;
+
+// What an epoll event points at
+typedef struct {
+    EventSourceType type;
+    int fd;
+} EventSource;
+
+// One encoded frame, shared by every viewer of a game: each viewer is
+// sent the same bytes. Deltas form a chain in the order they were played;
+// a keyframe sits beside the chain and points at the delta after it, so a
+// viewer can start there. Only the event loop touches refs and next once
+// a worker has handed a chunk over.
+typedef struct StreamChunk {
+    int refs; // Viewers on it, chunks pointing at it, and the session
+    int length;
+    uint64_t sequence; // Deltas are numbered; a keyframe has the number of the delta before it
+    struct StreamChunk* next;
+    unsigned char data[];
+} StreamChunk;
+
+struct Viewer;
+
+typedef struct Session {
+    EventSource source; // First, so an event's pointer can be either
+
+    // Guarded by lock: shared between the event loop and a worker
+    pthread_mutex_t lock;
+    char input[SERVER_MAX_INPUT];
+    int inputLength;
+    int newInput;   // Input arrived since a worker last took it
+    int scheduled;  // Queued or being played by a worker
+    int inDoneList;
+    int closed;     // The client went away
+    int quit;       // The player quit or the game is over
+    char* pending;  // Output not yet written to the socket
+    int pendingLength;
+    int pendingCapacity;
+    int watched;        // Has viewers, so the worker encodes frames
+    int keyframeWanted; // A viewer is waiting to start
+    StreamChunk* newChunks; // Encoded by the worker, not yet handed to viewers
+    StreamChunk* newChunksTail;
+
+    // Only touched by the worker playing the session
+    int started;
+    uint64_t seed;
+    GameState state;
+    SaveSnapshot snapshot;
+    TermPlayer player;
+    TermScreen screen;
+    SpectateView* view; // What viewers have been sent, while watched
+    int framesSinceKeyframe;
+
+    // Event loop only
+    unsigned long id; // Set before the first run, which shows it
+    int wantWrite;
+    int dead;                 // Destroyed; freed after the current batch of events
+    StreamChunk* chainTail;   // Latest delta
+    StreamChunk* keyframe;    // Latest keyframe
+    uint64_t sequence;
+    struct Viewer* viewers;
+    struct Session* prev;
+    struct Session* next;
+    struct Session* nextWork; // Guarded by workLock
+    struct Session* nextDone; // Guarded by doneLock
+} Session;
+
+// A spectator connection
+typedef struct Viewer {
+    EventSource source;    // First, like Session
+    Session* session;      // The game watched; NULL before the viewer names one and after it ends
+    StreamChunk* current;  // Being sent; NULL while waiting for a keyframe
+    int offset;            // Bytes of current already sent
+    char request[24];      // The game number, up to the newline
+    int requestLength;     // -1 once the viewer is watching
+    int wantWrite;
+    int dead;
+    struct Viewer* prev;   // Among the session's viewers, or lobbyViewers
+    struct Viewer* next;
+} Viewer;
+
+static int epollFd = -1;
+static EventSource wake = {SOURCE_WAKE, -1}; // eventfd: workers have finished sessions
+static int screenRows = SERVER_ROWS;
+static int screenCols = SERVER_COLS;
+static Session* allSessions = NULL;
+static Session* deadSessions = NULL; // Linked through next
+static long liveSessions = 0;
+static Viewer* lobbyViewers = NULL; // Not watching a running game
+static Viewer* deadViewers = NULL;
+static long liveViewers = 0;
+static long long totalSessions = 0;
+static volatile sig_atomic_t stopRequested = 0;
+
+// Sessions waiting for a worker
+static pthread_mutex_t workLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t workReady = PTHREAD_COND_INITIALIZER;
+static Session* workHead = NULL;
+static Session* workTail = NULL;
+static int workersStopping = 0;
+
+// Sessions a worker has finished with, for the event loop to flush
+static pthread_mutex_t doneLock = PTHREAD_MUTEX_INITIALIZER;
+static Session* doneHead = NULL;
+
+// Frames are encoded here, then copied into a chunk of the right size
+static _Thread_local unsigned char frameBuffer[SPECTATE_FRAME_BOUND];
+
+static void onStop(int sig) {
+    (void)sig;
+    stopRequested = 1;
+}
+
+static void pushWork(Session* session) {
+    pthread_mutex_lock(&workLock);
+    session->nextWork = NULL;
+    if (workTail != NULL) {
+        workTail->nextWork = session;
+    } else {
+        workHead = session;
+    }
+    workTail = session;
+    pthread_cond_signal(&workReady);
+    pthread_mutex_unlock(&workLock);
+}
+
+static void pushDone(Session* session) {
+    uint64_t one = 1;
+    pthread_mutex_lock(&doneLock);
+    session->nextDone = doneHead;
+    doneHead = session;
+    pthread_mutex_unlock(&doneLock);
+    if (write(wake.fd, &one, sizeof(one)) < 0) {
+        // The counter is already nonzero; the loop will wake anyway
+    }
+}
+
+static int appendPending(Session* session, const char* data, int length) {
+    if (session->pendingLength + length > session->pendingCapacity) {
+        int capacity = session->pendingCapacity > 0 ? session->pendingCapacity : 4096;
+        while (capacity < session->pendingLength + length) capacity *= 2;
+        char* grown = realloc(session->pending, capacity);
+        if (grown == NULL) return -1;
+        session->pending = grown;
+        session->pendingCapacity = capacity;
+    }
+    memcpy(session->pending + session->pendingLength, data, length);
+    session->pendingLength += length;
+    return 0;
+}
+
+static StreamChunk* makeChunk(const unsigned char* data, size_t length) {
+    StreamChunk* chunk = malloc(sizeof(StreamChunk) + length);
+    if (chunk == NULL) return NULL;
+    chunk->refs = 0;
+    chunk->length = (int)length;
+    chunk->sequence = 0;
+    chunk->next = NULL;
+    memcpy(chunk->data, data, length);
+    return chunk;
+}
+
+// Encode what this run changed for the game's viewers: a delta for the
+// chain, and a keyframe when a viewer is waiting for one, on a new level,
+// and every SPECTATE_KEYFRAME_INTERVAL frames. Returns the chunks linked
+// through next, or NULL if there is nothing to send. Sets *failed if out
+// of memory.
+static StreamChunk* encodeForViewers(Session* session, int watched, int keyframeWanted, int* failed) {
+    *failed = 0;
+    if (!watched) {
+        free(session->view);
+        session->view = NULL;
+        return NULL;
+    }
+    if (session->view == NULL) {
+        session->view = malloc(sizeof(SpectateView));
+        if (session->view == NULL) {
+            *failed = 1;
+            return NULL;
+        }
+        keyframeWanted = 1;
+    }
+
+    StreamChunk* delta = NULL;
+    if (!keyframeWanted) {
+        int newLevel = session->view->stats[STAT_DUNGEON_LEVEL] != dungeonLevel;
+        size_t size = encodeSpectateFrame(session->view, 0, frameBuffer);
+        if (size == SPECTATE_HEADER_SIZE + SPECTATE_EMPTY_DELTA_SIZE) return NULL;
+        delta = makeChunk(frameBuffer, size);
+        if (delta == NULL) {
+            *failed = 1;
+            return NULL;
+        }
+        keyframeWanted = newLevel || ++session->framesSinceKeyframe >= SPECTATE_KEYFRAME_INTERVAL;
+    }
+    if (!keyframeWanted) return delta;
+
+    size_t size = encodeSpectateFrame(session->view, 1, frameBuffer);
+    StreamChunk* keyframe = makeChunk(frameBuffer, size);
+    if (keyframe == NULL) {
+        *failed = 1;
+        free(delta);
+        return NULL;
+    }
+    session->framesSinceKeyframe = 0;
+    if (delta == NULL) return keyframe;
+    delta->next = keyframe;
+    return delta;
+}
+
+// Swap the session's game in, play the keys that arrived, render and
+// swap it back out. Runs on a worker; the session is ours until
+// `scheduled` is cleared.
+static void runSession(Session* session) {
+    char keys[SERVER_MAX_INPUT];
+    int length;
+    pthread_mutex_lock(&session->lock);
+    length = session->inputLength;
+    memcpy(keys, session->input, length);
+    session->inputLength = 0;
+    session->newInput = 0;
+    int watched = session->watched;
+    int keyframeWanted = session->keyframeWanted;
+    session->keyframeWanted = 0;
+    pthread_mutex_unlock(&session->lock);
+
+    if (!session->started) {
+        char welcome[64];
+        seedGameRand(session->seed);
+        newGame();
+        updateVisibility();
+        snprintf(welcome, sizeof(welcome), "Welcome to game %lu! Press ? for help.", session->id);
+        showMessage(welcome);
+        session->started = 1;
+    } else {
+        restoreSnapshot(&session->snapshot);
+        gameState = session->state;
+    }
+
+    // Keys can be split across packets: keep a partial escape sequence
+    // for next time
+    int offset = 0;
+    int quit = 0;
+    while (!quit && offset < length) {
+        int used;
+        int key = readTermKey(keys + offset, length - offset, &used);
+        if (key == TERM_KEY_INCOMPLETE) break;
+        offset += used;
+        quit = !handleTermKey(&session->player, &session->screen, key);
+    }
+    if (quit) {
+        termEmit(&session->screen, "\x1b[0m\x1b[2J\x1b[HGoodbye!\r\n");
+    } else {
+        renderTermScreen(&session->screen);
+    }
+    int encodeFailed;
+    StreamChunk* chunks = encodeForViewers(session, watched, keyframeWanted, &encodeFailed);
+    captureSnapshot(&session->snapshot);
+    session->state = gameState;
+
+    pthread_mutex_lock(&session->lock);
+    if (appendPending(session, session->screen.output, session->screen.outputLength) != 0 || encodeFailed) {
+        session->closed = 1; // Out of memory: give up on this client
+    }
+    if (chunks != NULL) {
+        if (session->newChunksTail != NULL) {
+            session->newChunksTail->next = chunks;
+        } else {
+            session->newChunks = chunks;
+        }
+        session->newChunksTail = chunks->next != NULL ? chunks->next : chunks;
+    }
+    session->screen.outputLength = 0;
+    int leftover = quit ? 0 : length - offset;
+    if (leftover > 0 && session->inputLength + leftover <= SERVER_MAX_INPUT) {
+        memmove(session->input + leftover, session->input, session->inputLength);
+        memcpy(session->input, keys + offset, leftover);
+        session->inputLength += leftover;
+    }
+    session->quit |= quit;
+    int requeue = session->newInput && !session->quit && !session->closed;
+    if (!requeue) session->scheduled = 0;
+    int notify = !session->inDoneList;
+    session->inDoneList = 1;
+    pthread_mutex_unlock(&session->lock);
+
+    if (notify) pushDone(session);
+    if (requeue) pushWork(session);
+}
+
+static void* workerMain(void* unused) {
+    (void)unused;
+    while (1) {
+        pthread_mutex_lock(&workLock);
+        while (workHead == NULL && !workersStopping) {
+            pthread_cond_wait(&workReady, &workLock);
+        }
+        Session* session = workHead;
+        if (session == NULL) {
+            pthread_mutex_unlock(&workLock);
+            break;
+        }
+        workHead = session->nextWork;
+        if (workHead == NULL) workTail = NULL;
+        pthread_mutex_unlock(&workLock);
+
+        runSession(session);
+    }
+    return NULL;
+}
+
+static StreamChunk* holdChunk(StreamChunk* chunk) {
+    chunk->refs++;
+    return chunk;
+}
+
+// Drop a reference, freeing the chunk and any of the chain after it that
+// nothing else holds
+static void releaseChunk(StreamChunk* chunk) {
+    while (chunk != NULL && --chunk->refs == 0) {
+        StreamChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+}
+
+static Viewer** viewerList(Viewer* viewer) {
+    return viewer->session != NULL ? &viewer->session->viewers : &lobbyViewers;
+}
+
+static void linkViewer(Viewer* viewer) {
+    Viewer** list = viewerList(viewer);
+    viewer->prev = NULL;
+    viewer->next = *list;
+    if (*list != NULL) (*list)->prev = viewer;
+    *list = viewer;
+}
+
+static void unlinkViewer(Viewer* viewer) {
+    if (viewer->prev != NULL) {
+        viewer->prev->next = viewer->next;
+    } else {
+        *viewerList(viewer) = viewer->next;
+    }
+    if (viewer->next != NULL) viewer->next->prev = viewer->prev;
+    viewer->prev = NULL;
+    viewer->next = NULL;
+}
+
+// Nobody is watching any more: stop encoding frames and let the chain go
+static void stopBroadcast(Session* session) {
+    pthread_mutex_lock(&session->lock);
+    session->watched = 0;
+    pthread_mutex_unlock(&session->lock);
+    releaseChunk(session->chainTail);
+    releaseChunk(session->keyframe);
+    session->chainTail = NULL;
+    session->keyframe = NULL;
+}
+
+static void destroyViewer(Viewer* viewer) {
+    Session* session = viewer->session;
+    unlinkViewer(viewer);
+    if (session != NULL && session->viewers == NULL) stopBroadcast(session);
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, viewer->source.fd, NULL);
+    close(viewer->source.fd);
+    releaseChunk(viewer->current);
+    viewer->current = NULL;
+    viewer->session = NULL;
+    viewer->dead = 1;
+    viewer->next = deadViewers;
+    deadViewers = viewer;
+    liveViewers--;
+}
+
+static void freeDeadViewers() {
+    while (deadViewers != NULL) {
+        Viewer* viewer = deadViewers;
+        deadViewers = viewer->next;
+        free(viewer);
+    }
+}
+
+static void watchViewerWrites(Viewer* viewer, int wantWrite) {
+    if (viewer->wantWrite == wantWrite) return;
+    struct epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP | (wantWrite ? EPOLLOUT : 0);
+    event.data.ptr = viewer;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, viewer->source.fd, &event);
+    viewer->wantWrite = wantWrite;
+}
+
+// Move the viewer on to the next chunk once it has sent this one
+static void advanceViewer(Viewer* viewer, StreamChunk* next) {
+    StreamChunk* chunk = viewer->current;
+    viewer->current = holdChunk(next);
+    viewer->offset = 0;
+    releaseChunk(chunk);
+}
+
+// Send the viewer the frames it hasn't had, straight out of the shared
+// chunks. Returns -1 once the viewer should be closed: it went away, or
+// it has been sent the end of the game.
+static int flushViewer(Viewer* viewer) {
+    while (viewer->current != NULL) {
+        StreamChunk* chunk = viewer->current;
+        if (viewer->offset == chunk->length) {
+            if (chunk->data[0] == FRAME_END) return -1;
+            if (chunk->next == NULL) break; // Caught up
+            advanceViewer(viewer, chunk->next);
+            continue;
+        }
+
+        // Too far behind: skip to the latest keyframe, which sums up the
+        // deltas skipped. Only between frames, never partway through one.
+        Session* session = viewer->session;
+        if (viewer->offset == 0 && session != NULL && session->keyframe != NULL && session->keyframe != chunk &&
+            session->keyframe->sequence >= chunk->sequence && session->sequence - chunk->sequence > SPECTATE_MAX_LAG) {
+            advanceViewer(viewer, session->keyframe);
+            continue;
+        }
+
+        struct iovec parts[SPECTATE_MAX_IOV];
+        int count = 0;
+        for (StreamChunk* part = chunk; part != NULL && count < SPECTATE_MAX_IOV; part = part->next) {
+            int skip = part == chunk ? viewer->offset : 0;
+            parts[count].iov_base = part->data + skip;
+            parts[count].iov_len = part->length - skip;
+            count++;
+        }
+        ssize_t n = writev(viewer->source.fd, parts, count);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            watchViewerWrites(viewer, 1);
+            return 0;
+        }
+        if (n <= 0) return -1;
+
+        while (n > 0) {
+            int taken = viewer->current->length - viewer->offset;
+            if (taken > n) taken = (int)n;
+            viewer->offset += taken;
+            n -= taken;
+            if (n > 0) advanceViewer(viewer, viewer->current->next);
+        }
+    }
+    watchViewerWrites(viewer, 0);
+    return 0;
+}
+
+// Send new frames to everyone watching the session
+static void flushViewers(Session* session) {
+    Viewer* viewer = session->viewers;
+    while (viewer != NULL) {
+        Viewer* next = viewer->next;
+        if (flushViewer(viewer) != 0) destroyViewer(viewer);
+        viewer = next;
+    }
+}
+
+// Add a delta (or the end) to the session's chain
+static void appendChunk(Session* session, StreamChunk* chunk) {
+    chunk->sequence = ++session->sequence;
+    if (session->chainTail != NULL) {
+        session->chainTail->next = holdChunk(chunk);
+        releaseChunk(session->chainTail);
+    }
+    session->chainTail = holdChunk(chunk);
+    if (session->keyframe != NULL && session->keyframe->next == NULL) {
+        session->keyframe->next = holdChunk(chunk);
+    }
+}
+
+// Make a keyframe the place new viewers start from
+static void setKeyframe(Session* session, StreamChunk* chunk) {
+    chunk->sequence = session->sequence;
+    releaseChunk(session->keyframe);
+    session->keyframe = holdChunk(chunk);
+    for (Viewer* viewer = session->viewers; viewer != NULL; viewer = viewer->next) {
+        if (viewer->current == NULL) viewer->current = holdChunk(chunk);
+    }
+}
+
+// Hand the chunks a worker encoded to the viewers
+static void publishChunks(Session* session, StreamChunk* chunks) {
+    if (chunks == NULL) return;
+    while (chunks != NULL) {
+        StreamChunk* chunk = chunks;
+        chunks = chunk->next;
+        chunk->next = NULL;
+        if (session->viewers == NULL) {
+            free(chunk); // The last viewer left while the worker was encoding
+        } else if (chunk->data[0] == FRAME_KEYFRAME) {
+            setKeyframe(session, chunk);
+        } else {
+            appendChunk(session, chunk);
+        }
+    }
+    flushViewers(session);
+}
+
+// The game is over: send viewers the end of the stream, then close them
+// once they have it
+static void endBroadcast(Session* session) {
+    unsigned char end[SPECTATE_HEADER_SIZE];
+    StreamChunk* chunk = NULL;
+    if (session->viewers != NULL) {
+        chunk = makeChunk(end, writeSpectateHeader(end, FRAME_END, 0));
+    }
+    if (chunk != NULL) appendChunk(session, chunk);
+
+    while (session->viewers != NULL) {
+        Viewer* viewer = session->viewers;
+        unlinkViewer(viewer);
+        viewer->session = NULL;
+        linkViewer(viewer);
+        if (viewer->current == NULL || flushViewer(viewer) != 0) destroyViewer(viewer);
+    }
+    stopBroadcast(session);
+    while (session->newChunks != NULL) {
+        StreamChunk* next = session->newChunks->next;
+        free(session->newChunks);
+        session->newChunks = next;
+    }
+    free(session->view);
+    session->view = NULL;
+}
+
+static void destroySession(Session* session) {
+    endBroadcast(session);
+    if (session->source.fd >= 0) {
+        epoll_ctl(epollFd, EPOLL_CTL_DEL, session->source.fd, NULL);
+        close(session->source.fd);
+    }
+    if (session->prev != NULL) {
+        session->prev->next = session->next;
+    } else {
+        allSessions = session->next;
+    }
+    if (session->next != NULL) session->next->prev = session->prev;
+    session->source.fd = -1;
+    session->dead = 1;
+    session->next = deadSessions;
+    deadSessions = session;
+    liveSessions--;
+}
+
+// Free destroyed sessions once no event in the current batch can refer
+// to them
+static void freeDeadSessions() {
+    while (deadSessions != NULL) {
+        Session* session = deadSessions;
+        deadSessions = session->next;
+        freeTermScreen(&session->screen);
+        free(session->pending);
+        pthread_mutex_destroy(&session->lock);
+        free(session);
+    }
+}
+
+// The client hung up: stop listening to it, and free the session once
+// no worker has it
+static void dropSession(Session* session) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, session->source.fd, NULL);
+    close(session->source.fd);
+    session->source.fd = -1;
+
+    pthread_mutex_lock(&session->lock);
+    session->closed = 1;
+    int busy = session->scheduled || session->inDoneList;
+    pthread_mutex_unlock(&session->lock);
+    if (!busy) destroySession(session);
+}
+
+static void watchWrites(Session* session, int wantWrite) {
+    if (session->wantWrite == wantWrite || session->source.fd < 0) return;
+    struct epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP | (wantWrite ? EPOLLOUT : 0);
+    event.data.ptr = session;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, session->source.fd, &event);
+    session->wantWrite = wantWrite;
+}
+
+// Write as much pending output as the socket takes. Returns -1 if the
+// client is gone or too far behind.
+static int flushSession(Session* session) {
+    if (session->source.fd < 0) return -1;
+    pthread_mutex_lock(&session->lock);
+    int written = 0;
+    int failed = 0;
+    while (written < session->pendingLength) {
+        ssize_t n = send(session->source.fd, session->pending + written, session->pendingLength - written, MSG_NOSIGNAL);
+        if (n > 0) {
+            written += (int)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            failed = n < 0 && errno != EAGAIN && errno != EWOULDBLOCK;
+            break;
+        }
+    }
+    memmove(session->pending, session->pending + written, session->pendingLength - written);
+    session->pendingLength -= written;
+    int remaining = session->pendingLength;
+    pthread_mutex_unlock(&session->lock);
+
+    if (failed || remaining > SERVER_MAX_OUTPUT) return -1;
+    watchWrites(session, remaining > 0);
+    return 0;
+}
+
+// A worker is done with the session: send its output, and free it if
+// the player has left
+static void finishSession(Session* session) {
+    pthread_mutex_lock(&session->lock);
+    session->inDoneList = 0;
+    StreamChunk* chunks = session->newChunks;
+    session->newChunks = NULL;
+    session->newChunksTail = NULL;
+    pthread_mutex_unlock(&session->lock);
+
+    publishChunks(session, chunks);
+    int failed = flushSession(session) != 0;
+
+    pthread_mutex_lock(&session->lock);
+    int finished = (session->quit || session->closed || failed) && !session->scheduled;
+    session->closed |= failed;
+    pthread_mutex_unlock(&session->lock);
+    if (finished) destroySession(session);
+}
+
+static void readClient(Session* session) {
+    char buffer[SERVER_READ_SIZE];
+    while (1) {
+        ssize_t n = read(session->source.fd, buffer, sizeof(buffer));
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        if (n <= 0) {
+            dropSession(session);
+            return;
+        }
+
+        pthread_mutex_lock(&session->lock);
+        int room = SERVER_MAX_INPUT - session->inputLength;
+        int taken = (int)n < room ? (int)n : room; // A flood of keys: drop the excess
+        memcpy(session->input + session->inputLength, buffer, taken);
+        session->inputLength += taken;
+        session->newInput = 1;
+        int schedule = !session->scheduled && !session->quit;
+        session->scheduled |= schedule;
+        pthread_mutex_unlock(&session->lock);
+        if (schedule) pushWork(session);
+    }
+}
+
+static void acceptClients(EventSource* listener) {
+    while (1) {
+        int fd = accept4(listener->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                printf("accept failed: %s\n", strerror(errno));
+            }
+            return;
+        }
+
+        Session* session = calloc(1, sizeof(Session));
+        if (session == NULL || initTermScreen(&session->screen, screenRows, screenCols) != 0) {
+            free(session);
+            close(fd);
+            continue;
+        }
+        session->source.type = SOURCE_CLIENT;
+        session->source.fd = fd;
+        pthread_mutex_init(&session->lock, NULL);
+        session->seed = (uint64_t)time(NULL) * 1000003u + (uint64_t)totalSessions;
+        session->player.localGame = 0;
+        session->id = (unsigned long)totalSessions + 1;
+
+        struct epoll_event event;
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.ptr = session;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            freeTermScreen(&session->screen);
+            pthread_mutex_destroy(&session->lock);
+            free(session);
+            close(fd);
+            continue;
+        }
+        session->next = allSessions;
+        if (allSessions != NULL) allSessions->prev = session;
+        allSessions = session;
+        liveSessions++;
+        totalSessions++;
+
+        // The first run starts the game and draws the first screen
+        session->scheduled = 1;
+        pushWork(session);
+    }
+}
+
+// Start the viewer on the named game: from its latest keyframe, or from
+// the next one if nobody was watching
+static int subscribeViewer(Viewer* viewer, unsigned long id) {
+    Session* session = allSessions;
+    while (session != NULL && session->id != id) session = session->next;
+    if (session == NULL) return -1;
+
+    unlinkViewer(viewer);
+    viewer->session = session;
+    viewer->requestLength = -1;
+    linkViewer(viewer);
+    if (session->keyframe != NULL) {
+        viewer->current = holdChunk(session->keyframe);
+        return flushViewer(viewer);
+    }
+
+    // Have a worker encode a keyframe, even if the player is idle
+    pthread_mutex_lock(&session->lock);
+    int schedule = 0;
+    if (!session->watched) {
+        session->watched = 1;
+        session->keyframeWanted = 1;
+        schedule = !session->scheduled && !session->quit && !session->closed;
+        session->scheduled |= schedule;
+    }
+    pthread_mutex_unlock(&session->lock);
+    if (schedule) pushWork(session);
+    return 0;
+}
+
+// Read the game number a viewer wants; anything after it is ignored
+static void readViewer(Viewer* viewer) {
+    char buffer[SERVER_READ_SIZE];
+    while (1) {
+        ssize_t n = read(viewer->source.fd, buffer, sizeof(buffer));
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        if (n <= 0) {
+            destroyViewer(viewer);
+            return;
+        }
+        for (int i = 0; i < n && viewer->requestLength >= 0; i++) {
+            if (buffer[i] != '\n') {
+                if (viewer->requestLength == (int)sizeof(viewer->request) - 1) {
+                    destroyViewer(viewer);
+                    return;
+                }
+                viewer->request[viewer->requestLength++] = buffer[i];
+                continue;
+            }
+            viewer->request[viewer->requestLength] = '\0';
+            if (subscribeViewer(viewer, strtoul(viewer->request, NULL, 10)) != 0) {
+                destroyViewer(viewer); // No such game, or it went away already
+                return;
+            }
+        }
+    }
+}
+
+static void acceptViewers(EventSource* listener) {
+    while (1) {
+        int fd = accept4(listener->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                printf("accept failed: %s\n", strerror(errno));
+            }
+            return;
+        }
+
+        Viewer* viewer = calloc(1, sizeof(Viewer));
+        if (viewer == NULL) {
+            close(fd);
+            continue;
+        }
+        viewer->source.type = SOURCE_VIEWER;
+        viewer->source.fd = fd;
+        struct epoll_event event;
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.ptr = viewer;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            free(viewer);
+            close(fd);
+            continue;
+        }
+        linkViewer(viewer);
+        liveViewers++;
+    }
+}
+
+static int listenOn(EventSource* listener, EventSourceType type, struct sockaddr* address, socklen_t addressLength, const char* name) {
+    listener->type = type;
+    listener->fd = socket(address->sa_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listener->fd < 0) {
+        printf("Could not create a socket for %s: %s\n", name, strerror(errno));
+        return -1;
+    }
+    int reuse = 1;
+    setsockopt(listener->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (bind(listener->fd, address, addressLength) != 0 || listen(listener->fd, SERVER_BACKLOG) != 0) {
+        printf("Could not listen on %s: %s\n", name, strerror(errno));
+        close(listener->fd);
+        listener->fd = -1;
+        return -1;
+    }
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = listener;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listener->fd, &event);
+    printf("Listening on %s\n", name);
+    return 0;
+}
+
+// Each session holds a socket, so allow as many as the hard limit does
+static void raiseFileLimit() {
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+static void usage(const char* program) {
+    printf("Usage: %s [-p port] [-u socket-path] [-w watch-port] [-j workers] [-size COLSxROWS]\n", program);
+    printf("       -p 0 turns TCP off; spectators are off unless -w is given\n");
+}
+
+int main(int argc, char* argv[]) {
+    int port = SERVER_PORT;
+    const char* socketPath = NULL;
+    int watchPort = 0;
+    int numWorkers = countProcessors();
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-p") == 0) {
+            port = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-u") == 0) {
+            socketPath = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "-w") == 0) {
+            watchPort = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-j") == 0) {
+            numWorkers = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "-size") == 0) {
+            if (sscanf(argv[++i], "%dx%d", &screenCols, &screenRows) != 2 || screenCols < 20 || screenRows < 5) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (numWorkers < 1) numWorkers = 1;
+
+    raiseFileLimit();
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction stop;
+    memset(&stop, 0, sizeof(stop));
+    stop.sa_handler = onStop;
+    sigaction(SIGINT, &stop, NULL);
+    sigaction(SIGTERM, &stop, NULL);
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wake.fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd < 0 || wake.fd < 0) {
+        printf("Could not set up the event loop: %s\n", strerror(errno));
+        return 1;
+    }
+    struct epoll_event wakeEvent;
+    wakeEvent.events = EPOLLIN;
+    wakeEvent.data.ptr = &wake;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wake.fd, &wakeEvent);
+
+    EventSource tcpListener = {SOURCE_LISTENER, -1};
+    EventSource unixListener = {SOURCE_LISTENER, -1};
+    EventSource watchListener = {SOURCE_WATCH_LISTENER, -1};
+    if (port > 0) {
+        char name[32];
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons((uint16_t)port);
+        snprintf(name, sizeof(name), "TCP port %d", port);
+        listenOn(&tcpListener, SOURCE_LISTENER, (struct sockaddr*)&address, sizeof(address), name);
+    }
+    if (socketPath != NULL) {
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        snprintf(address.sun_path, sizeof(address.sun_path), "%s", socketPath);
+        unlink(socketPath); // A socket left behind by an earlier run
+        listenOn(&unixListener, SOURCE_LISTENER, (struct sockaddr*)&address, sizeof(address), socketPath);
+    }
+    if (watchPort > 0) {
+        char name[48];
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons((uint16_t)watchPort);
+        snprintf(name, sizeof(name), "TCP port %d for spectators", watchPort);
+        listenOn(&watchListener, SOURCE_WATCH_LISTENER, (struct sockaddr*)&address, sizeof(address), name);
+    }
+    if (tcpListener.fd < 0 && unixListener.fd < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    pthread_t* workers = malloc(sizeof(pthread_t) * numWorkers);
+    int started = 0;
+    while (workers != NULL && started < numWorkers && pthread_create(&workers[started], NULL, workerMain, NULL) == 0) {
+        started++;
+    }
+    if (started == 0) {
+        printf("Could not start any worker threads\n");
+        return 1;
+    }
+    printf("%d workers, %dx%d screens\n", started, screenCols, screenRows);
+
+    struct epoll_event events[SERVER_MAX_EVENTS];
+    while (!stopRequested) {
+        int count = epoll_wait(epollFd, events, SERVER_MAX_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            printf("epoll_wait failed: %s\n", strerror(errno));
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            EventSource* source = events[i].data.ptr;
+            if (source->type == SOURCE_LISTENER) {
+                acceptClients(source);
+            } else if (source->type == SOURCE_WATCH_LISTENER) {
+                acceptViewers(source);
+            } else if (source->type == SOURCE_VIEWER) {
+                Viewer* viewer = (Viewer*)source;
+                if (viewer->dead) continue;
+                if ((events[i].events & EPOLLOUT) && flushViewer(viewer) != 0) {
+                    destroyViewer(viewer);
+                    continue;
+                }
+                if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                    readViewer(viewer);
+                }
+            } else if (source->type == SOURCE_WAKE) {
+                uint64_t ignored;
+                if (read(wake.fd, &ignored, sizeof(ignored)) < 0) {
+                    // Already reset by an earlier wakeup
+                }
+                pthread_mutex_lock(&doneLock);
+                Session* done = doneHead;
+                doneHead = NULL;
+                pthread_mutex_unlock(&doneLock);
+                while (done != NULL) {
+                    Session* next = done->nextDone;
+                    finishSession(done);
+                    done = next;
+                }
+            } else {
+                // A session destroyed earlier in this batch may still
+                // have events in it
+                Session* session = (Session*)source;
+                if (session->dead) continue;
+                if (events[i].events & EPOLLOUT) {
+                    if (flushSession(session) != 0) {
+                        dropSession(session);
+                        continue;
+                    }
+                }
+                if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                    readClient(session);
+                }
+            }
+        }
+        freeDeadSessions();
+        freeDeadViewers();
+    }
+
+    printf("Stopping: %ld sessions open, %lld served, %ld spectators\n", liveSessions, totalSessions, liveViewers);
+    pthread_mutex_lock(&workLock);
+    workersStopping = 1;
+    pthread_cond_broadcast(&workReady);
+    pthread_mutex_unlock(&workLock);
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+    while (allSessions != NULL) {
+        destroySession(allSessions);
+    }
+    while (lobbyViewers != NULL) {
+        destroyViewer(lobbyViewers);
+    }
+    freeDeadSessions();
+    freeDeadViewers();
+    if (unixListener.fd >= 0) {
+        close(unixListener.fd);
+        unlink(socketPath);
+    }
+    if (tcpListener.fd >= 0) close(tcpListener.fd);
+    if (watchListener.fd >= 0) close(watchListener.fd);
+    close(wake.fd);
+    close(epollFd);
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include <string.h>
+#include "lz.h"
+#include "spectate.h"
+
+#define MASK_MESSAGE (1u << SPECTATE_STAT_COUNT)
+#define MASK_CAUSE_OF_DEATH (1u << (SPECTATE_STAT_COUNT + 1))
+
+// Keyframes are built here before they are compressed, and decompressed
+// here before they are applied
+static _Thread_local unsigned char keyframeScratch[SPECTATE_RAW_BOUND];
+
+static unsigned char* putU16(unsigned char* out, unsigned int value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    return out + 2;
+}
+
+static unsigned char* putU32(unsigned char* out, uint32_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+    out[2] = (unsigned char)(value >> 16);
+    out[3] = (unsigned char)(value >> 24);
+    return out + 4;
+}
+
+static uint32_t getU32(const unsigned char* in) {
+    return in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+// The player field behind a stat; dungeon level and game state are globals
+static int* statField(SpectateStat stat) {
+    switch (stat) {
+        case STAT_X: return &player.x;
+        case STAT_Y: return &player.y;
+        case STAT_HP: return &player.hp;
+        case STAT_MAX_HP: return &player.maxHp;
+        case STAT_MANA: return &player.mana;
+        case STAT_MAX_MANA: return &player.maxMana;
+        case STAT_INTELLIGENCE: return &player.intelligence;
+        case STAT_SCORE: return &player.score;
+        case STAT_POTIONS: return &player.healthPotions;
+        case STAT_FOOD: return &player.foodInInventory;
+        case STAT_LEVEL: return &player.level;
+        case STAT_XP: return &player.xp;
+        case STAT_XP_TO_NEXT: return &player.xpToNextLevel;
+        case STAT_VISIBILITY_RADIUS: return &player.visibilityRadius;
+        case STAT_DUNGEON_LEVEL: return &dungeonLevel;
+        default: return NULL;
+    }
+}
+
+static int32_t readStat(SpectateStat stat) {
+    if (stat == STAT_GAME_STATE) return (int32_t)gameState;
+    return *statField(stat);
+}
+
+void resetSpectateView(SpectateView* view) {
+    memset(view, 0, sizeof(*view));
+}
+
+size_t writeSpectateHeader(unsigned char* out, SpectateFrameType type, size_t payloadSize) {
+    out[0] = (unsigned char)type;
+    putU32(out + 1, (uint32_t)payloadSize);
+    return SPECTATE_HEADER_SIZE;
+}
+
+// Append a length-prefixed string to the payload if it changed
+static unsigned char* putString(unsigned char* out, char* sent, size_t sentSize, const char* current) {
+    size_t length = strnlen(current, sentSize - 1);
+    *out++ = (unsigned char)length;
+    memcpy(out, current, length);
+    memset(sent, 0, sentSize);
+    memcpy(sent, current, length);
+    return out + length;
+}
+
+// Write what changed since `view` and update it; returns the payload size
+static size_t encodeDelta(SpectateView* view, unsigned char* out) {
+    unsigned char* p = out + 4; // Mask goes in front once known
+    uint32_t mask = 0;
+
+    for (int stat = 0; stat < SPECTATE_STAT_COUNT; stat++) {
+        int32_t value = readStat((SpectateStat)stat);
+        if (value == view->stats[stat]) continue;
+        mask |= 1u << stat;
+        view->stats[stat] = value;
+        p = putU32(p, (uint32_t)value);
+    }
+    const char* message = latestMessage();
+    if (strncmp(view->message, message, sizeof(view->message) - 1) != 0) {
+        mask |= MASK_MESSAGE;
+        p = putString(p, view->message, sizeof(view->message), message);
+    }
+    if (strncmp(view->causeOfDeath, player.causeOfDeath, sizeof(view->causeOfDeath) - 1) != 0) {
+        mask |= MASK_CAUSE_OF_DEATH;
+        p = putString(p, view->causeOfDeath, sizeof(view->causeOfDeath), player.causeOfDeath);
+    }
+    putU32(out, mask);
+
+    // Tiles as the player knows them: unexplored ones are 0
+    unsigned char* countAt = p;
+    unsigned int tileCount = 0;
+    p += 2;
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) {
+            char tile = visibility[y][x] ? map[y][x] : 0;
+            if (tile == view->tiles[y][x]) continue;
+            view->tiles[y][x] = tile;
+            p = putU16(p, (unsigned int)(y * MAP_WIDTH + x));
+            *p++ = (unsigned char)tile;
+            tileCount++;
+        }
+    }
+    putU16(countAt, tileCount);
+
+    // Monsters in sight; one that left it (or died) is sent with symbol 0
+    countAt = p++;
+    unsigned int monsterCount = 0;
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        unsigned char current[3] = {0, 0, 0};
+        if (monsters[i].active && getDistance(player.x, player.y, monsters[i].x, monsters[i].y) <= player.visibilityRadius) {
+            current[0] = (unsigned char)monsters[i].symbol;
+            current[1] = (unsigned char)monsters[i].x;
+            current[2] = (unsigned char)monsters[i].y;
+        }
+        if (memcmp(current, view->monsters[i], sizeof(current)) == 0) continue;
+        memcpy(view->monsters[i], current, sizeof(current));
+        *p++ = (unsigned char)i;
+        memcpy(p, current, sizeof(current));
+        p += sizeof(current);
+        monsterCount++;
+    }
+    *countAt = (unsigned char)monsterCount;
+    return (size_t)(p - out);
+}
+
+size_t encodeSpectateFrame(SpectateView* view, int keyframe, unsigned char* out) {
+    unsigned char* payload = out + SPECTATE_HEADER_SIZE;
+    if (!keyframe) {
+        size_t size = encodeDelta(view, payload);
+        return writeSpectateHeader(out, FRAME_DELTA, size) + size;
+    }
+
+    resetSpectateView(view);
+    size_t rawSize = encodeDelta(view, keyframeScratch);
+    putU32(payload, (uint32_t)rawSize);
+    size_t packed = lzCompress(keyframeScratch, rawSize, payload + 4, lzCompressBound(SPECTATE_RAW_BOUND));
+    return writeSpectateHeader(out, FRAME_KEYFRAME, 4 + packed) + 4 + packed;
+}
+
+// Copy a length-prefixed string out of the payload
+static const unsigned char* getString(const unsigned char* p, const unsigned char* end, char* dst, size_t dstSize) {
+    if (p >= end) return NULL;
+    size_t length = *p++;
+    if (length >= dstSize || (size_t)(end - p) < length) return NULL;
+    memcpy(dst, p, length);
+    dst[length] = '\0';
+    return p + length;
+}
+
+static int applyDelta(const unsigned char* p, size_t size) {
+    const unsigned char* end = p + size;
+    if (size < 4) return -1;
+    uint32_t mask = getU32(p);
+    p += 4;
+
+    for (int stat = 0; stat < SPECTATE_STAT_COUNT; stat++) {
+        if (!(mask & (1u << stat))) continue;
+        if (end - p < 4) return -1;
+        int32_t value = (int32_t)getU32(p);
+        p += 4;
+        if (stat == STAT_GAME_STATE) {
+            gameState = (GameState)value;
+        } else {
+            *statField((SpectateStat)stat) = value;
+        }
+    }
+    if (mask & MASK_MESSAGE) {
+        char message[256];
+        p = getString(p, end, message, sizeof(message));
+        if (p == NULL) return -1;
+        // The new message replaces the one on screen, or clears it if empty
+        messageLog.turnHasMessages = 0;
+        messageLog.firstRecent = messageLog.count;
+        if (message[0] != '\0') showMessage(message);
+    }
+    if (mask & MASK_CAUSE_OF_DEATH) {
+        p = getString(p, end, player.causeOfDeath, sizeof(player.causeOfDeath));
+        if (p == NULL) return -1;
+    }
+
+    if (end - p < 2) return -1;
+    unsigned int tileCount = p[0] | p[1] << 8;
+    p += 2;
+    if ((size_t)(end - p) < tileCount * 3) return -1;
+    for (unsigned int i = 0; i < tileCount; i++, p += 3) {
+        unsigned int index = p[0] | p[1] << 8;
+        if (index >= MAP_WIDTH * MAP_HEIGHT) return -1;
+        int y = index / MAP_WIDTH;
+        int x = index % MAP_WIDTH;
+        visibility[y][x] = p[2] != 0;
+        map[y][x] = p[2] != 0 ? (char)p[2] : ' ';
+    }
+    if (tileCount > 0) mapVersion++;
+
+    if (end - p < 1) return -1;
+    unsigned int monsterCount = *p++;
+    if ((size_t)(end - p) < monsterCount * 4) return -1;
+    for (unsigned int i = 0; i < monsterCount; i++, p += 4) {
+        if (p[0] >= MAX_MONSTERS) return -1;
+        Monster* monster = &monsters[p[0]];
+        monster->symbol = (char)p[1];
+        monster->x = p[2];
+        monster->y = p[3];
+        monster->active = p[1] != 0;
+    }
+    return p == end ? 0 : -1;
+}
+
+int applySpectateFrame(SpectateFrameType type, const unsigned char* payload, size_t size) {
+    if (type == FRAME_DELTA) return applyDelta(payload, size);
+    if (type == FRAME_END) return 0;
+    if (type != FRAME_KEYFRAME || size < 4) return -1;
+
+    uint32_t rawSize = getU32(payload);
+    if (rawSize > sizeof(keyframeScratch) ||
+        lzDecompress(payload + 4, size - 4, keyframeScratch, sizeof(keyframeScratch)) != (long)rawSize) {
+        return -1;
+    }
+    // Start from an empty screen, which is what the keyframe was encoded against
+    memset(&player, 0, sizeof(player));
+    memset(monsters, 0, sizeof(monsters));
+    memset(visibility, 0, sizeof(visibility));
+    memset(map, ' ', sizeof(map));
+    memset(&messageLog, 0, sizeof(messageLog));
+    dungeonLevel = 0;
+    gameState = STATE_PLAYING;
+    return applyDelta(keyframeScratch, rawSize);
+}
@@ -0,0 +1,68 @@
+#ifndef SPECTATE_H
+#define SPECTATE_H
+
+#include <stddef.h>
+#include "game.h"
+
+// Spectator stream: what a player's screen shows, as frames a viewer
+// applies to its own copy of the game state. Every frame is
+//   type (1 byte), payload length (4 bytes, little-endian), payload
+// A delta carries only what changed since the frame before it: the stats
+// that changed, tiles that were explored or changed, monsters that moved
+// into, within or out of sight, and the message if it changed. So its
+// size follows the turn, not the map. A keyframe is a delta from an empty
+// screen, LZ-compressed, and lets a viewer start from scratch.
+
+#define SPECTATE_HEADER_SIZE 5
+
+// Largest payload before compression: mask and stats, both strings, every
+// tile and every monster
+#define SPECTATE_RAW_BOUND (4 + 4 * SPECTATE_STAT_COUNT + 256 + 30 + \
+                            2 + 3 * MAP_WIDTH * MAP_HEIGHT + 1 + 4 * MAX_MONSTERS)
+
+// Largest frame encodeSpectateFrame writes: a keyframe that didn't compress
+#define SPECTATE_FRAME_BOUND (SPECTATE_HEADER_SIZE + 4 + SPECTATE_RAW_BOUND + SPECTATE_RAW_BOUND / 255 + 16)
+
+// Payload of a delta in which nothing changed
+#define SPECTATE_EMPTY_DELTA_SIZE 7
+
+typedef enum {
+    FRAME_KEYFRAME = 1,
+    FRAME_DELTA = 2,
+    FRAME_END = 3 // The game is over or the player left; no payload
+} SpectateFrameType;
+
+// Player and game fields a delta can carry, one bit each in its mask
+typedef enum {
+    STAT_X, STAT_Y, STAT_HP, STAT_MAX_HP, STAT_MANA, STAT_MAX_MANA, STAT_INTELLIGENCE,
+    STAT_SCORE, STAT_POTIONS, STAT_FOOD, STAT_LEVEL, STAT_XP, STAT_XP_TO_NEXT,
+    STAT_VISIBILITY_RADIUS, STAT_DUNGEON_LEVEL, STAT_GAME_STATE,
+    SPECTATE_STAT_COUNT
+} SpectateStat;
+
+// What viewers were last sent, which the encoder diffs against
+typedef struct {
+    int32_t stats[SPECTATE_STAT_COUNT];
+    char tiles[MAP_HEIGHT][MAP_WIDTH];       // 0 where unexplored
+    unsigned char monsters[MAX_MONSTERS][3]; // Symbol (0 when out of sight), x, y
+    char message[256];
+    char causeOfDeath[30];
+} SpectateView;
+
+// Forget everything sent, as for a viewer that just joined
+void resetSpectateView(SpectateView* view);
+
+// Encode the current game state as a frame, a delta against `view` or a
+// keyframe, and bring `view` up to date. `out` takes SPECTATE_FRAME_BOUND
+// bytes. Returns the frame size.
+size_t encodeSpectateFrame(SpectateView* view, int keyframe, unsigned char* out);
+
+// Write a frame header; returns SPECTATE_HEADER_SIZE
+size_t writeSpectateHeader(unsigned char* out, SpectateFrameType type, size_t payloadSize);
+
+// Viewer side: apply a frame's payload to the game state (map, visibility,
+// monsters, player, message and game state). Returns 0 on success, -1 if
+// the payload is malformed.
+int applySpectateFrame(SpectateFrameType type, const unsigned char* payload, size_t size);
+
+#endif // SPECTATE_H
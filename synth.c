@@ -0,0 +1,104 @@
+#include <math.h>
+#include "game.h"
+#include "synth.h"
+
+#define ATTACK_MILLISECONDS 3
+
+const SynthPatch synthPatches[] = {
+    {SOUND_BEEP, 2, {{WAVE_SQUARE, 220, 220, 180, 0.30f}, {WAVE_SQUARE, 165, 165, 260, 0.30f}}}, // Starving
+    {SOUND_HIT, 2, {{WAVE_NOISE, 0, 0, 60, 0.50f}, {WAVE_TRIANGLE, 180, 60, 90, 0.60f}}},
+    {SOUND_MISSILE, 1, {{WAVE_SQUARE, 1400, 300, 220, 0.20f}}},
+    {SOUND_PICKUP, 2, {{WAVE_SINE, 880, 880, 60, 0.40f}, {WAVE_SINE, 1320, 1320, 90, 0.40f}}},
+    {SOUND_LEVELUP, 4, {{WAVE_TRIANGLE, 523, 523, 110, 0.50f}, {WAVE_TRIANGLE, 659, 659, 110, 0.50f},
+                        {WAVE_TRIANGLE, 784, 784, 110, 0.50f}, {WAVE_TRIANGLE, 1047, 1047, 320, 0.50f}}},
+};
+
+const int synthPatchCount = sizeof(synthPatches) / sizeof(synthPatches[0]);
+
+static int noteFrames(const SynthNote* note, int rate) {
+    return (int)((long)note->milliseconds * rate / 1000);
+}
+
+size_t synthFrames(const SynthPatch* patch, int rate) {
+    size_t frames = 0;
+    for (int i = 0; i < patch->noteCount; i++) {
+        frames += (size_t)noteFrames(&patch->notes[i], rate);
+    }
+    return frames;
+}
+
+// One block of a note, from frame `first` of `total`. The phase has a
+// closed form for a linear slide, so no step depends on the one before
+// it. Every loop runs a whole block, which lets -O2 vectorize it; frames
+// past the end of the note are computed and not used.
+static void renderBlock(const SynthNote* note, int rate, int first, int total, float* restrict samples) {
+    float slide = (note->endHz - note->startHz) / (2.0f * total);
+    float attack = (float)(ATTACK_MILLISECONDS * rate / 1000 + 1);
+    for (int i = 0; i < SYNTH_BLOCK; i++) {
+        float t = (float)(first + i);
+        float cycles = (note->startHz + slide * t) * t / rate;
+        samples[i] = cycles - (float)(int)cycles; // Phase, 0..1
+    }
+
+    switch (note->wave) {
+        case WAVE_SQUARE:
+            for (int i = 0; i < SYNTH_BLOCK; i++) samples[i] = samples[i] < 0.5f ? 1.0f : -1.0f;
+            break;
+        case WAVE_TRIANGLE:
+            for (int i = 0; i < SYNTH_BLOCK; i++) samples[i] = 4.0f * fabsf(samples[i] - 0.5f) - 1.0f;
+            break;
+        case WAVE_SINE:
+            for (int i = 0; i < SYNTH_BLOCK; i++) {
+                float x = 1.0f - 2.0f * samples[i];
+                samples[i] = 4.0f * x * (1.0f - fabsf(x));
+            }
+            break;
+        case WAVE_NOISE:
+            // A hash of the frame number rather than a running generator
+            for (int i = 0; i < SYNTH_BLOCK; i++) {
+                uint32_t h = (uint32_t)(first + i) * 0x9E3779B1u;
+                h ^= h >> 15;
+                h *= 0x85EBCA77u;
+                h ^= h >> 13;
+                samples[i] = (float)(int32_t)(h >> 8) * (2.0f / 16777216.0f) - 1.0f;
+            }
+            break;
+    }
+
+    // Attack, then a quadratic fall to silence at the end of the note
+    for (int i = 0; i < SYNTH_BLOCK; i++) {
+        float t = (float)(first + i);
+        float x = t / attack;
+        float rise = 0.5f * (x + 1.0f - fabsf(x - 1.0f)); // min(x, 1) without a branch
+        float fall = 1.0f - t / total;
+        samples[i] *= note->volume * rise * fall * fall;
+    }
+}
+
+// Clamp and convert a block to 16-bit samples
+static void quantizeBlock(const float* restrict samples, int16_t* restrict pcm) {
+    for (int i = 0; i < SYNTH_BLOCK; i++) {
+        float value = 0.5f * (fabsf(samples[i] + 1.0f) - fabsf(samples[i] - 1.0f)); // Clamped to -1..1
+        pcm[i] = (int16_t)(value * 32767.0f);
+    }
+}
+
+void renderSynthPatch(const SynthPatch* patch, int rate, int channels, int16_t* out) {
+    float samples[SYNTH_BLOCK];
+    int16_t pcm[SYNTH_BLOCK];
+    for (int n = 0; n < patch->noteCount; n++) {
+        const SynthNote* note = &patch->notes[n];
+        int total = noteFrames(note, rate);
+        for (int first = 0; first < total; first += SYNTH_BLOCK) {
+            int count = total - first < SYNTH_BLOCK ? total - first : SYNTH_BLOCK;
+            renderBlock(note, rate, first, total, samples);
+            quantizeBlock(samples, pcm);
+            for (int i = 0; i < count; i++) {
+                for (int c = 0; c < channels; c++) {
+                    out[i * channels + c] = pcm[i];
+                }
+            }
+            out += count * channels;
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Sound effects synthesized at startup instead of loaded from files.
+// Each sound is a few notes played one after another: a waveform whose
+// pitch slides from one frequency to another, shaped by a short attack
+// and a decay to silence. Notes are rendered in blocks of SYNTH_BLOCK
+// frames, each step a plain loop over floats that compilers vectorize,
+// into signed 16-bit samples the frontend hands to its mixer as is.
+
+#define SYNTH_MAX_NOTES 4
+#define SYNTH_BLOCK 256
+
+typedef enum {
+    WAVE_SQUARE,
+    WAVE_TRIANGLE,
+    WAVE_SINE,  // A parabolic approximation, close enough for effects
+    WAVE_NOISE
+} SynthWave;
+
+typedef struct {
+    SynthWave wave;
+    float startHz, endHz;
+    int milliseconds;
+    float volume; // 0..1
+} SynthNote;
+
+typedef struct {
+    unsigned int sound; // The SOUND_ bit of pendingSounds it is played for
+    int noteCount;
+    SynthNote notes[SYNTH_MAX_NOTES];
+} SynthPatch;
+
+extern const SynthPatch synthPatches[];
+extern const int synthPatchCount;
+
+// Length of the patch in frames (one sample per channel) at `rate`
+size_t synthFrames(const SynthPatch* patch, int rate);
+
+// Render the patch into `out`, which holds synthFrames() * channels
+// samples; every channel gets the same signal
+void renderSynthPatch(const SynthPatch* patch, int rate, int channels, int16_t* out);
+
+#endif // SYNTH_H
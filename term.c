@@ -0,0 +1,302 @@
+// Terminal frontend: plays the game in a VT100/ANSI terminal, for example
+// over SSH. Each frame is drawn into a cell buffer and compared with a
+// shadow copy of what the terminal already shows, so a turn only sends
+// the cells that changed (see termui.c). Saves, autosaves and recordings
+// work as in the SDL game.
+//
+// With --watch it plays nothing and shows a game on a moria_server
+// instead, applying the server's spectator frames (spectate.h) to its own
+// game state and drawing that.
+//
+// Usage: moria_term [--resume]
+//        moria_term --watch host:port game
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "game.h"
+#include "replay.h"
+#include "save.h"
+#include "spectate.h"
+#include "termui.h"
+
+static TermScreen screen;
+static struct termios savedTermios;
+static int rawMode = 0;
+static volatile sig_atomic_t resized = 0;
+
+static void flushOutput() {
+    int written = 0;
+    while (written < screen.outputLength) {
+        ssize_t n = write(STDOUT_FILENO, screen.output + written, screen.outputLength - written);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break; // The terminal went away; nothing useful left to do
+        }
+        written += (int)n;
+    }
+    screen.outputLength = 0;
+}
+
+static void restoreTerminal() {
+    static const char reset[] = "\x1b[0m\x1b[?25h\x1b[?1049l";
+    if (!rawMode) return;
+    if (write(STDOUT_FILENO, reset, sizeof(reset) - 1) < 0) {
+        // Nothing to do about it
+    }
+    tcsetattr(STDIN_FILENO, TCSAFLUSH, &savedTermios);
+    rawMode = 0;
+}
+
+static void onSignal(int sig) {
+    restoreTerminal();
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+static void onResize(int sig) {
+    (void)sig;
+    resized = 1;
+}
+
+// Fit the screen to the terminal, clearing it
+static int fitScreen() {
+    struct winsize size;
+    int rows = 24;
+    int cols = 80;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0 && size.ws_col > 0) {
+        rows = size.ws_row;
+        cols = size.ws_col;
+    }
+    if (screen.output == NULL) return initTermScreen(&screen, rows, cols);
+    return resizeTermScreen(&screen, rows, cols);
+}
+
+static int enterRawMode() {
+    if (tcgetattr(STDIN_FILENO, &savedTermios) != 0) {
+        printf("Could not read the terminal settings\n");
+        return -1;
+    }
+    if (fitScreen() != 0) {
+        printf("Out of memory for the screen\n");
+        return -1;
+    }
+    struct termios raw = savedTermios;
+    raw.c_iflag &= ~(IXON | ICRNL);
+    raw.c_lflag &= ~(ECHO | ICANON | IEXTEN); // Keep ISIG so Ctrl-C still quits
+    raw.c_cc[VMIN] = 1;
+    raw.c_cc[VTIME] = 0;
+    if (tcsetattr(STDIN_FILENO, TCSAFLUSH, &raw) != 0) {
+        printf("Could not switch the terminal to raw mode\n");
+        return -1;
+    }
+    rawMode = 1;
+    atexit(restoreTerminal);
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGHUP, onSignal);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = onResize; // No SA_RESTART: a resize interrupts read()
+    sigaction(SIGWINCH, &action, NULL);
+
+    // Alternate screen and hidden cursor, ahead of the clear fitScreen queued
+    static const char setup[] = "\x1b[?1049h\x1b[?25l";
+    if (write(STDOUT_FILENO, setup, sizeof(setup) - 1) < 0) {
+        return -1;
+    }
+    return 0;
+}
+
+// Connect to host:port; returns the socket or -1
+static int connectTo(const char* address) {
+    char host[256];
+    const char* colon = strrchr(address, ':');
+    if (colon == NULL || colon == address || (size_t)(colon - address) >= sizeof(host)) {
+        printf("Expected host:port, not %s\n", address);
+        return -1;
+    }
+    memcpy(host, address, colon - address);
+    host[colon - address] = '\0';
+
+    struct addrinfo hints;
+    struct addrinfo* found;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    int error = getaddrinfo(host, colon + 1, &hints, &found);
+    if (error != 0) {
+        printf("Could not find %s: %s\n", host, gai_strerror(error));
+        return -1;
+    }
+    int fd = -1;
+    for (struct addrinfo* candidate = found; candidate != NULL && fd < 0; candidate = candidate->ai_next) {
+        fd = socket(candidate->ai_family, candidate->ai_socktype, candidate->ai_protocol);
+        if (fd >= 0 && connect(fd, candidate->ai_addr, candidate->ai_addrlen) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(found);
+    if (fd < 0) printf("Could not connect to %s: %s\n", address, strerror(errno));
+    return fd;
+}
+
+// Apply every whole frame in the buffer; returns the bytes used, or -1 if
+// a frame is malformed. Sets *ended at the end of the stream.
+static long applyFrames(const unsigned char* data, size_t length, int* ended) {
+    size_t used = 0;
+    while (length - used >= SPECTATE_HEADER_SIZE) {
+        const unsigned char* frame = data + used;
+        size_t payloadSize = frame[1] | frame[2] << 8 | (size_t)frame[3] << 16 | (size_t)frame[4] << 24;
+        if (payloadSize > SPECTATE_FRAME_BOUND - SPECTATE_HEADER_SIZE) return -1;
+        if (length - used < SPECTATE_HEADER_SIZE + payloadSize) break;
+        if (applySpectateFrame((SpectateFrameType)frame[0], frame + SPECTATE_HEADER_SIZE, payloadSize) != 0) return -1;
+        if (frame[0] == FRAME_END) *ended = 1;
+        used += SPECTATE_HEADER_SIZE + payloadSize;
+    }
+    return (long)used;
+}
+
+// Show a game played on a server until it ends or q is pressed
+static int watchGame(const char* address, const char* game) {
+    static unsigned char received[2 * SPECTATE_FRAME_BOUND];
+    size_t length = 0;
+    char request[32];
+
+    int fd = connectTo(address);
+    if (fd < 0) return 1;
+    int requestLength = snprintf(request, sizeof(request), "%s\n", game);
+    if (send(fd, request, requestLength, MSG_NOSIGNAL) != requestLength) {
+        printf("Could not ask for game %s\n", game);
+        close(fd);
+        return 1;
+    }
+    if (enterRawMode() != 0) {
+        close(fd);
+        return 1;
+    }
+
+    int started = 0; // Nothing to draw before the first keyframe
+    int ended = 0;
+    int running = 1;
+    while (running) {
+        if (resized) {
+            resized = 0;
+            fitScreen();
+        }
+        if (started) {
+            renderTermScreen(&screen);
+            flushOutput();
+        }
+
+        struct pollfd sources[2] = {{STDIN_FILENO, POLLIN, 0}, {fd, POLLIN, 0}};
+        if (poll(sources, ended ? 1 : 2, -1) < 0) {
+            if (errno == EINTR) continue; // Resized: redraw
+            break;
+        }
+        if (sources[0].revents & POLLIN) {
+            char keys[64];
+            ssize_t n = read(STDIN_FILENO, keys, sizeof(keys));
+            if (n <= 0 || memchr(keys, 'q', n) != NULL || ended) break;
+        }
+        if (!ended && (sources[1].revents & (POLLIN | POLLHUP | POLLERR))) {
+            ssize_t n = recv(fd, received + length, sizeof(received) - length, 0);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                if (!started) break; // Turned away: no such game
+                ended = 1;           // The server went away
+            } else {
+                length += (size_t)n;
+                long used = applyFrames(received, length, &ended);
+                if (used < 0) break;
+                started |= used > 0;
+                memmove(received, received + used, length - used);
+                length -= (size_t)used;
+            }
+            if (ended) {
+                started = 1;
+                if (gameState != STATE_GAMEOVER && gameState != STATE_WIN) {
+                    showMessage("The game has ended. Press any key to stop watching.");
+                }
+            }
+        }
+    }
+
+    restoreTerminal();
+    freeTermScreen(&screen);
+    close(fd);
+    if (!started) printf("No game %s is being played there\n", game);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    TermPlayer state = {1, 0, 0};
+    int resume = argc > 1 && strcmp(argv[1], "--resume") == 0;
+    if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO)) {
+        printf("%s needs a terminal\n", argv[0]);
+        return 1;
+    }
+    if (argc > 1 && strcmp(argv[1], "--watch") == 0) {
+        if (argc != 4) {
+            printf("Usage: %s --watch host:port game\n", argv[0]);
+            return 1;
+        }
+        return watchGame(argv[2], argv[3]);
+    }
+
+    seedGameRand(time(NULL));
+    if (!resume || loadGame(SAVE_FILE) != 0) {
+        newGame();
+    }
+    updateVisibility();
+    if (enterRawMode() != 0) {
+        return 1;
+    }
+    startAutosave(SAVE_FILE);
+    startRecording(REPLAY_FILE);
+
+    int running = 1;
+    while (running) {
+        if (resized) {
+            resized = 0;
+            fitScreen();
+        }
+        renderTermScreen(&screen);
+        flushOutput();
+
+        char keys[64];
+        ssize_t length = read(STDIN_FILENO, keys, sizeof(keys));
+        if (length < 0 && errno == EINTR) continue; // Resized: redraw
+        if (length <= 0) break;
+
+        // A terminal delivers each escape sequence in one read, so one
+        // cut short is a lone ESC
+        for (int offset = 0, used; running && offset < length; offset += used) {
+            int key = readTermKey(keys + offset, (int)length - offset, &used);
+            if (key == TERM_KEY_INCOMPLETE) {
+                key = TERM_KEY_ESCAPE;
+                used = (int)length - offset;
+            }
+            running = handleTermKey(&state, &screen, key);
+        }
+    }
+
+    stopRecording();
+    stopAutosave();
+    if (gameState != STATE_GAMEOVER && gameState != STATE_WIN) {
+        saveGame(SAVE_FILE); // Quit mid-game: keep a save to --resume from
+    }
+    restoreTerminal();
+    freeTermScreen(&screen);
+    return 0;
+}
@@ -0,0 +1,450 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "replay.h"
+#include "save.h"
+#include "termui.h"
+#include "travel.h"
+
+#define TERM_OUTPUT_INITIAL 4096
+
+// SGR foreground colours
+#define COLOR_DEFAULT 39
+#define COLOR_RED 91
+#define COLOR_GREEN 92
+#define COLOR_YELLOW 93
+#define COLOR_CYAN 96
+#define COLOR_WHITE 97
+#define COLOR_GRAY 37
+#define COLOR_DARK_GRAY 90
+#define COLOR_DARK_YELLOW 33
+#define COLOR_DARK_CYAN 36
+
+int initTermScreen(TermScreen* screen, int rows, int cols) {
+    memset(screen, 0, sizeof(*screen));
+    screen->output = malloc(TERM_OUTPUT_INITIAL);
+    if (screen->output == NULL) return -1;
+    screen->outputCapacity = TERM_OUTPUT_INITIAL;
+    if (resizeTermScreen(screen, rows, cols) != 0) {
+        freeTermScreen(screen);
+        return -1;
+    }
+    return 0;
+}
+
+int resizeTermScreen(TermScreen* screen, int rows, int cols) {
+    TermCell* shown = malloc(sizeof(TermCell) * rows * cols);
+    TermCell* frame = malloc(sizeof(TermCell) * rows * cols);
+    if (shown == NULL || frame == NULL) {
+        free(shown);
+        free(frame);
+        return -1;
+    }
+    free(screen->shown);
+    free(screen->frame);
+    screen->shown = shown;
+    screen->frame = frame;
+    screen->rows = rows;
+    screen->cols = cols;
+    invalidateTermScreen(screen);
+    return 0;
+}
+
+void freeTermScreen(TermScreen* screen) {
+    free(screen->shown);
+    free(screen->frame);
+    free(screen->output);
+    memset(screen, 0, sizeof(*screen));
+}
+
+void termEmit(TermScreen* screen, const char* format, ...) {
+    va_list args;
+    while (1) {
+        int room = screen->outputCapacity - screen->outputLength;
+        va_start(args, format);
+        int n = vsnprintf(screen->output + screen->outputLength, room, format, args);
+        va_end(args);
+        if (n < 0) return;
+        if (n < room) {
+            screen->outputLength += n;
+            return;
+        }
+        char* grown = realloc(screen->output, screen->outputCapacity * 2 + n);
+        if (grown == NULL) return; // Drop it; the next full redraw repairs the screen
+        screen->output = grown;
+        screen->outputCapacity = screen->outputCapacity * 2 + n;
+    }
+}
+
+void invalidateTermScreen(TermScreen* screen) {
+    for (int i = 0; i < screen->rows * screen->cols; i++) {
+        screen->shown[i].ch = ' ';
+        screen->shown[i].color = COLOR_DEFAULT;
+    }
+    termEmit(screen, "\x1b[0m\x1b[2J");
+    screen->cursorRow = -1;
+    screen->cursorCol = -1;
+    screen->currentColor = COLOR_DEFAULT;
+}
+
+static void clearFrame(TermScreen* screen) {
+    for (int i = 0; i < screen->rows * screen->cols; i++) {
+        screen->frame[i].ch = ' ';
+        screen->frame[i].color = COLOR_DEFAULT;
+    }
+}
+
+static void putCell(TermScreen* screen, int row, int col, char ch, int color) {
+    if (row < 0 || row >= screen->rows || col < 0 || col >= screen->cols) return;
+    TermCell* cell = &screen->frame[row * screen->cols + col];
+    cell->ch = ch;
+    cell->color = (unsigned char)color;
+}
+
+static void putText(TermScreen* screen, int row, int col, const char* text, int color) {
+    for (; *text != '\0' && col < screen->cols; text++, col++) {
+        putCell(screen, row, col, *text, color);
+    }
+}
+
+static void putCentered(TermScreen* screen, int row, const char* text, int color) {
+    int col = (screen->cols - (int)strlen(text)) / 2;
+    putText(screen, row, col < 0 ? 0 : col, text, color);
+}
+
+// Append the cells that differ from what the terminal shows, moving the
+// cursor and changing colour only where the previous cell doesn't leave
+// the terminal in the right state already
+static void presentTermScreen(TermScreen* screen) {
+    for (int r = 0; r < screen->rows; r++) {
+        for (int c = 0; c < screen->cols; c++) {
+            TermCell* want = &screen->frame[r * screen->cols + c];
+            TermCell* have = &screen->shown[r * screen->cols + c];
+            if (want->ch == have->ch && want->color == have->color) continue;
+
+            if (screen->cursorRow == r && screen->cursorCol == c) {
+                // Already there
+            } else if (screen->cursorRow == r && screen->cursorCol < c) {
+                termEmit(screen, "\x1b[%dC", c - screen->cursorCol);
+            } else {
+                termEmit(screen, "\x1b[%d;%dH", r + 1, c + 1);
+            }
+            if (want->color != screen->currentColor) {
+                termEmit(screen, "\x1b[%dm", want->color);
+                screen->currentColor = want->color;
+            }
+            termEmit(screen, "%c", want->ch);
+            *have = *want;
+            screen->cursorRow = r;
+            screen->cursorCol = c + 1;
+            if (screen->cursorCol >= screen->cols) screen->cursorRow = -1; // Pending wrap: position unknown
+        }
+    }
+}
+
+static int tileColor(char tile, int currentlyVisible) {
+    switch (tile) {
+        case '#': return currentlyVisible ? COLOR_GRAY : COLOR_DARK_GRAY;
+        case '>': return currentlyVisible ? COLOR_YELLOW : COLOR_DARK_YELLOW;
+        case '!': return currentlyVisible ? COLOR_CYAN : COLOR_DARK_CYAN;
+        case 'F': return currentlyVisible ? COLOR_DARK_YELLOW : COLOR_DARK_GRAY;
+        default:  return currentlyVisible ? COLOR_WHITE : COLOR_GRAY;
+    }
+}
+
+// Stats on the top row, the map in between, the message on the bottom row
+static void renderGame(TermScreen* screen) {
+    int rows = screen->rows;
+    int cols = screen->cols;
+    int mapRows = rows - 2;
+    int cameraX = player.x - cols / 2;
+    int cameraY = player.y - mapRows / 2;
+    if (cameraX > MAP_WIDTH - cols) cameraX = MAP_WIDTH - cols;
+    if (cameraY > MAP_HEIGHT - mapRows) cameraY = MAP_HEIGHT - mapRows;
+    if (cameraX < 0) cameraX = 0;
+    if (cameraY < 0) cameraY = 0;
+
+    for (int y = 0; y < mapRows; y++) {
+        int mapY = cameraY + y;
+        if (mapY >= MAP_HEIGHT) break;
+        for (int x = 0; x < cols; x++) {
+            int mapX = cameraX + x;
+            if (mapX >= MAP_WIDTH) break;
+            if (!visibility[mapY][mapX]) continue;
+            int currentlyVisible = getDistance(player.x, player.y, mapX, mapY) <= player.visibilityRadius;
+            putCell(screen, y + 1, x, map[mapY][mapX], tileColor(map[mapY][mapX], currentlyVisible));
+        }
+    }
+
+    // Monsters, only if they are currently within sight
+    for (int i = 0; i < MAX_MONSTERS; i++) {
+        if (monsters[i].active && getDistance(player.x, player.y, monsters[i].x, monsters[i].y) <= player.visibilityRadius &&
+            monsters[i].y >= cameraY && monsters[i].y - cameraY < mapRows) {
+            putCell(screen, monsters[i].y - cameraY + 1, monsters[i].x - cameraX, monsters[i].symbol, COLOR_RED);
+        }
+    }
+    putCell(screen, player.y - cameraY + 1, player.x - cameraX, '@', COLOR_GREEN);
+
+    char statsBuffer[256];
+    snprintf(statsBuffer, sizeof(statsBuffer), "HP: %d/%d | Mana: %d/%d | Int: %d | Score: %d | Potions: %d | Food: %d | Lvl: %d | XP: %d/%d | Dlvl: %d",
+             player.hp, player.maxHp, player.mana, player.maxMana, player.intelligence, player.score, player.healthPotions, player.foodInInventory, player.level, player.xp, player.xpToNextLevel, dungeonLevel);
+    putText(screen, 0, 0, statsBuffer, COLOR_WHITE);
+    putText(screen, rows - 1, 0, latestMessage(), COLOR_WHITE);
+}
+
+static void renderHelpScreen(TermScreen* screen) {
+    static const char* lines[] = {
+        "--- Controls ---",
+        "Arrow Keys: Move",
+        "Shift + Arrow Key: Run",
+        "r: Rest (recover HP/Mana)",
+        "R: Rest until healed",
+        "x: Explore, >: Travel to Stairs",
+        "h: Cast Healing Spell",
+        "f + Arrow Key: Cast Magic Missile",
+        "t: Cast Phase Door",
+        "p: Use Health Potion",
+        "e: Eat Food",
+        "s: Save Game",
+        "l: Load Saved Game",
+        "?: Show Help (this screen)",
+        "q or ESC: Quit",
+        "Press any key to return to the game",
+    };
+    int count = sizeof(lines) / sizeof(lines[0]);
+    for (int i = 0; i < count; i++) {
+        putCentered(screen, (screen->rows - count) / 2 + i, lines[i], COLOR_WHITE);
+    }
+}
+
+static void renderEndScreen(TermScreen* screen) {
+    char line[128];
+    int middle = screen->rows / 2;
+    if (gameState == STATE_WIN) {
+        putCentered(screen, middle - 2, "Congratulations!", COLOR_GREEN);
+        putCentered(screen, middle - 1, "You have defeated the Lich Lord!", COLOR_WHITE);
+    } else {
+        putCentered(screen, middle - 2, "You have died!", COLOR_RED);
+        snprintf(line, sizeof(line), "Cause of Death: %s", player.causeOfDeath);
+        putCentered(screen, middle - 1, line, COLOR_WHITE);
+    }
+    snprintf(line, sizeof(line), "Final Score: %d", player.score);
+    putCentered(screen, middle, line, COLOR_WHITE);
+    putCentered(screen, middle + 2, "Press any key to exit", COLOR_GRAY);
+}
+
+void renderTermScreen(TermScreen* screen) {
+    clearFrame(screen);
+    if (gameState == STATE_HELP) {
+        renderHelpScreen(screen);
+    } else if (gameState == STATE_GAMEOVER || gameState == STATE_WIN) {
+        renderEndScreen(screen);
+    } else {
+        renderGame(screen);
+    }
+    presentTermScreen(screen);
+}
+
+int readTermKey(const char* input, int length, int* used) {
+    *used = 0;
+    if (length <= 0) return TERM_KEY_INCOMPLETE;
+    if (input[0] != '\x1b') {
+        *used = 1;
+        return (unsigned char)input[0];
+    }
+    if (length == 1) return TERM_KEY_INCOMPLETE; // A lone ESC, or the start of a sequence
+    if (input[1] != '[' && input[1] != 'O') {
+        *used = 1;
+        return TERM_KEY_ESCAPE;
+    }
+
+    // CSI or SS3: parameter and intermediate bytes, then one final byte
+    int i = 2;
+    while (i < length && input[i] >= 0x20 && input[i] <= 0x3f) i++;
+    if (i >= length) return TERM_KEY_INCOMPLETE;
+    *used = i + 1;
+    int modifiers = 0;
+    if (i == 5 && memcmp(input + 2, "1;2", 3) == 0) {
+        modifiers = TERM_KEY_SHIFT; // Shift-arrow: ESC [ 1 ; 2 A..D
+    } else if (i > 2) {
+        return 0; // Other modified or special keys: ignored
+    }
+    switch (input[i]) {
+        case 'A': return TERM_KEY_UP | modifiers;
+        case 'B': return TERM_KEY_DOWN | modifiers;
+        case 'C': return TERM_KEY_RIGHT | modifiers;
+        case 'D': return TERM_KEY_LEFT | modifiers;
+        default:  return 0;
+    }
+}
+
+static void autosave(TermPlayer* state) {
+    state->turnsSinceAutosave = 0;
+    requestAutosave();
+}
+
+static int playRecordedTurn(TermPlayer* state, Action action) {
+    if (state->localGame) recordAction(action);
+    int turnPassed = playTurn(action);
+    if (state->localGame) recordTurnEnd();
+    return turnPassed;
+}
+
+// Show what the turns left behind and keep the autosave schedule. The
+// starving beep becomes the terminal bell; other sounds and missile
+// animations are skipped.
+static void presentTurns(TermPlayer* state, TermScreen* screen, int previousLevel, int turnsPlayed) {
+    if (pendingSounds & SOUND_BEEP) {
+        termEmit(screen, "\a");
+    }
+    pendingSounds = 0;
+    numEffects = 0;
+    if (gameState == STATE_LEVELUP) {
+        char tempBuffer[64];
+        snprintf(tempBuffer, sizeof(tempBuffer), "Welcome to Level %d!", player.level);
+        showMessage(tempBuffer);
+        gameState = STATE_PLAYING;
+    }
+
+    if (!state->localGame) return;
+    if (dungeonLevel != previousLevel) {
+        autosave(state);
+    } else if ((state->turnsSinceAutosave += turnsPlayed) >= AUTOSAVE_INTERVAL) {
+        autosave(state);
+    }
+}
+
+static void playerAction(TermPlayer* state, TermScreen* screen, Action action) {
+    int level = dungeonLevel;
+    presentTurns(state, screen, level, playRecordedTurn(state, action));
+}
+
+// Run or rest until something happens (see RepeatCommand), drawing only
+// the result
+static void playerRepeat(TermPlayer* state, TermScreen* screen, Action action) {
+    RepeatCommand command;
+    if (!startRepeat(&command, action, 0)) return;
+    int level = dungeonLevel;
+    int turnPassed;
+    do {
+        turnPassed = playRecordedTurn(state, action);
+    } while (continueRepeat(&command, turnPassed));
+    presentTurns(state, screen, level, command.turns);
+}
+
+// Auto-explore or travel to the stairs, drawing only where the walk ends
+static void playerTravel(TermPlayer* state, TermScreen* screen, TravelKind kind) {
+    TravelCommand travel;
+    Action action;
+    if (!startTravel(&travel, kind, 0, 0)) return;
+    int level = dungeonLevel;
+    while (nextTravelStep(&travel, &action)) {
+        if (!continueRepeat(&travel.repeat, playRecordedTurn(state, action))) break;
+    }
+    presentTurns(state, screen, level, travel.repeat.turns);
+}
+
+int handleTermKey(TermPlayer* state, TermScreen* screen, int key) {
+    Action action = {ACTION_NONE, 0, 0};
+    int shift = key > 0 && (key & TERM_KEY_SHIFT) != 0;
+    key &= ~TERM_KEY_SHIFT;
+    int dx = key == TERM_KEY_RIGHT ? 1 : key == TERM_KEY_LEFT ? -1 : 0;
+    int dy = key == TERM_KEY_DOWN ? 1 : key == TERM_KEY_UP ? -1 : 0;
+    int arrow = dx != 0 || dy != 0;
+
+    if (gameState == STATE_GAMEOVER || gameState == STATE_WIN) {
+        return 0; // Any key leaves the end screen
+    }
+    if (gameState == STATE_HELP) {
+        gameState = STATE_PLAYING;
+        return 1;
+    }
+    if (state->awaitingSpellDirection) {
+        state->awaitingSpellDirection = 0;
+        if (!arrow) {
+            showMessage("Magic missile cancelled.");
+            return 1;
+        }
+        action.type = ACTION_MISSILE;
+        action.dx = dx;
+        action.dy = dy;
+        playerAction(state, screen, action);
+        return 1;
+    }
+    if (arrow) {
+        action.type = ACTION_MOVE;
+        action.dx = dx;
+        action.dy = dy;
+        if (shift) {
+            playerRepeat(state, screen, action); // Run
+        } else {
+            playerAction(state, screen, action);
+        }
+        return 1;
+    }
+
+    switch (key) {
+        case TERM_KEY_ESCAPE:
+        case 'q':
+            return 0;
+        case 'r':
+            action.type = ACTION_REST;
+            break;
+        case 'R':
+            action.type = ACTION_REST;
+            playerRepeat(state, screen, action); // Rest until healed
+            return 1;
+        case 'h':
+            action.type = ACTION_HEAL;
+            break;
+        case 'x':
+            playerTravel(state, screen, TRAVEL_EXPLORE);
+            return 1;
+        case '>':
+            playerTravel(state, screen, TRAVEL_STAIRS);
+            return 1;
+        case 'f':
+            state->awaitingSpellDirection = 1;
+            showMessage("Choose a direction for magic missile!");
+            return 1;
+        case 't':
+            action.type = ACTION_PHASE_DOOR;
+            break;
+        case 'e':
+            action.type = ACTION_EAT;
+            break;
+        case 'p':
+            action.type = ACTION_POTION;
+            break;
+        case 's':
+            if (!state->localGame) {
+                showMessage("Saving is disabled on the server.");
+                return 1;
+            }
+            autosave(state); // Written in the background
+            showMessage("Game saved.");
+            return 1;
+        case 'l':
+            if (!state->localGame) {
+                showMessage("Loading is disabled on the server.");
+                return 1;
+            }
+            waitForAutosave(); // Don't read a save that is still being written
+            if (loadGame(SAVE_FILE) == 0) {
+                showMessage("Game loaded.");
+                startRecording(REPLAY_FILE); // The recording restarts from the loaded game
+            } else {
+                showMessage("No saved game to load!");
+            }
+            invalidateTermScreen(screen); // loadGame may have printed an error
+            return 1;
+        case '?':
+            gameState = STATE_HELP;
+            return 1;
+        default:
+            return 1;
+    }
+    playerAction(state, screen, action);
+    return 1;
+}
@@ -0,0 +1,71 @@
+#ifndef TERMUI_H
+#define TERMUI_H
+
+#include "game.h"
+
+// Terminal user interface shared by the terminal frontend and the game
+// server: a cell screen that sends only what changed as ANSI escape
+// sequences, and the key handling that turns keys into turns.
+
+typedef struct {
+    char ch;
+    unsigned char color; // SGR foreground colour
+} TermCell;
+
+// A client's screen. Drawing goes into `frame`; presentTermScreen
+// compares it with `shown`, what the terminal displays, and appends the
+// difference to `output` for the caller to send.
+typedef struct {
+    int rows;
+    int cols;
+    TermCell* shown;
+    TermCell* frame;
+    int cursorRow; // -1 if unknown
+    int cursorCol;
+    int currentColor;
+    char* output;
+    int outputLength;
+    int outputCapacity;
+} TermScreen;
+
+// Frontend state kept per player between keys
+typedef struct {
+    int localGame; // Saves, loads, autosaves and records; server sessions don't
+    int awaitingSpellDirection;
+    int turnsSinceAutosave;
+} TermPlayer;
+
+// Keys returned by readTermKey besides plain characters
+#define TERM_KEY_INCOMPLETE -1 // The input ends partway through an escape sequence
+#define TERM_KEY_ESCAPE 27
+#define TERM_KEY_UP 256
+#define TERM_KEY_DOWN 257
+#define TERM_KEY_RIGHT 258
+#define TERM_KEY_LEFT 259
+#define TERM_KEY_SHIFT 0x1000 // Added to an arrow key
+
+// Return 0 on success, -1 if out of memory
+int initTermScreen(TermScreen* screen, int rows, int cols);
+int resizeTermScreen(TermScreen* screen, int rows, int cols);
+void freeTermScreen(TermScreen* screen);
+
+// Clear the terminal and forget what it showed, so the next present
+// sends every non-blank cell
+void invalidateTermScreen(TermScreen* screen);
+
+// Append raw bytes, such as a bell, to the screen's output
+void termEmit(TermScreen* screen, const char* format, ...);
+
+// Draw the current game state (map and stats, help, or the end screen)
+// and append the changed cells to the output
+void renderTermScreen(TermScreen* screen);
+
+// Decode the key at the start of `input`, setting *used to the bytes it
+// took. Arrow keys arrive as ESC [ A..D or ESC O A..D, and with Shift
+// as ESC [ 1 ; 2 A..D.
+int readTermKey(const char* input, int length, int* used);
+
+// Apply one key to the current game. Returns 0 if the player quit.
+int handleTermKey(TermPlayer* state, TermScreen* screen, int key);
+
+#endif // TERMUI_H
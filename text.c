@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <string.h>
+#include "game.h"
+#include "text.h"
+
+#ifdef USE_SDL_TTF
+
+#include <SDL2/SDL_ttf.h>
+#include "assets.h"
+
+static TTF_Font* font = NULL;
+
+int initText() {
+    if (TTF_Init() == -1) {
+        printf("SDL_ttf could not initialize! TTF_Error: %s\n", TTF_GetError());
+        return -1;
+    }
+    // Load font from embedded data
+    size_t size;
+    const unsigned char* data = loadAsset("DejaVuSansMono.ttf", &size);
+    if (data == NULL) {
+        return -1;
+    }
+    SDL_RWops* rw = SDL_RWFromConstMem(data, (int)size);
+    font = TTF_OpenFontRW(rw, 1, TILE_SIZE);
+    if (font == NULL) {
+        printf("Failed to load font from memory! TTF_Error: %s\n", TTF_GetError());
+        return -1;
+    }
+    return 0;
+}
+
+void closeText() {
+    TTF_CloseFont(font);
+    font = NULL;
+    TTF_Quit();
+}
+
+SDL_Surface* renderText(const char* text, SDL_Color color) {
+    if (font == NULL || text[0] == '\0') return NULL;
+    return TTF_RenderText_Solid(font, text, color);
+}
+
+void sizeText(const char* text, int* width, int* height) {
+    int w = 0, h = 0;
+    if (font != NULL) TTF_SizeText(font, text, &w, &h);
+    if (width != NULL) *width = w;
+    if (height != NULL) *height = h;
+}
+
+#else
+
+#include "fontatlas.h"
+
+#if FONT_ATLAS_SIZE != TILE_SIZE
+#error "fontatlas.h is out of date with TILE_SIZE; run make fontatlas"
+#endif
+
+int initText() {
+    return 0; // The glyphs are part of the binary
+}
+
+void closeText() {
+}
+
+// Glyphs are copied bit by bit into an 8-bit surface: index 1 where the
+// glyph is set, and index 0, the colour key, everywhere else
+SDL_Surface* renderText(const char* text, SDL_Color color) {
+    int length = (int)strlen(text);
+    if (length == 0) return NULL;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, length * FONT_ATLAS_WIDTH, FONT_ATLAS_HEIGHT, 8,
+                                                          SDL_PIXELFORMAT_INDEX8);
+    if (surface == NULL) return NULL;
+    SDL_Color colors[2] = {{255 - color.r, 255 - color.g, 255 - color.b, 0}, color};
+    SDL_SetPaletteColors(surface->format->palette, colors, 0, 2);
+    SDL_SetColorKey(surface, SDL_TRUE, 0);
+
+    unsigned char* pixels = surface->pixels;
+    for (int y = 0; y < FONT_ATLAS_HEIGHT; y++) {
+        unsigned char* row = pixels + y * surface->pitch;
+        memset(row, 0, surface->w);
+        for (int i = 0; i < length; i++) {
+            int c = (unsigned char)text[i];
+            if (c < FONT_ATLAS_FIRST || c > FONT_ATLAS_LAST) c = '?';
+            const unsigned char* bits = fontAtlas[c - FONT_ATLAS_FIRST][y];
+            unsigned char* cell = row + i * FONT_ATLAS_WIDTH;
+            for (int x = 0; x < FONT_ATLAS_WIDTH; x++) {
+                cell[x] = (bits[x >> 3] >> (7 - (x & 7))) & 1;
+            }
+        }
+    }
+    return surface;
+}
+
+void sizeText(const char* text, int* width, int* height) {
+    if (width != NULL) *width = (int)strlen(text) * FONT_ATLAS_WIDTH;
+    if (height != NULL) *height = FONT_ATLAS_HEIGHT;
+}
+
+#endif
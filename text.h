@@ -0,0 +1,23 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <SDL2/SDL.h>
+
+// Text for the SDL frontend. Glyphs come from fontatlas.h, which fontgen
+// rasterizes from assets/DejaVuSansMono.ttf at build time, so starting
+// the game neither parses the TTF nor needs SDL_ttf. A `make TTF=1` build
+// (USE_SDL_TTF) embeds the TTF as an asset (assets.h) and renders
+// through SDL_ttf at runtime instead.
+
+// Returns 0 on success
+int initText();
+void closeText();
+
+// The text in `color` on a transparent background, like
+// TTF_RenderText_Solid. NULL for empty text. Free with SDL_FreeSurface.
+SDL_Surface* renderText(const char* text, SDL_Color color);
+
+// The size renderText would make the text; either pointer may be NULL
+void sizeText(const char* text, int* width, int* height);
+
+#endif // TEXT_H
@@ -0,0 +1,153 @@
+#include "trace.h"
+
+#ifdef TRACE_ENABLED
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+typedef struct {
+    const char* name;
+    uint64_t start;
+    uint64_t duration;
+} TraceEvent;
+
+// One per thread that has traced anything. Only the owning thread adds
+// events; the lock keeps a dump from reading an event half-written.
+typedef struct TraceBuffer {
+    TraceEvent events[TRACE_RING_SIZE];
+    uint64_t count; // Events ever added; the newest TRACE_RING_SIZE are kept
+    int threadId;
+    char threadName[32];
+    pthread_mutex_t lock;
+    struct TraceBuffer* next;
+} TraceBuffer;
+
+static _Thread_local TraceBuffer* threadBuffer = NULL;
+static TraceBuffer* allBuffers = NULL;
+static int numBuffers = 0;
+static uint64_t traceOrigin = 0; // Time of the first event, so timestamps stay small
+static pthread_mutex_t traceLock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t traceNow() {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000ull +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000ull / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+// The calling thread's buffer, created on first use. NULL if out of
+// memory, in which case the thread's events are dropped.
+static TraceBuffer* getThreadBuffer() {
+    if (threadBuffer != NULL) return threadBuffer;
+    TraceBuffer* buffer = calloc(1, sizeof(TraceBuffer));
+    if (buffer == NULL) return NULL;
+    pthread_mutex_init(&buffer->lock, NULL);
+
+    pthread_mutex_lock(&traceLock);
+    if (numBuffers == 0) traceOrigin = traceNow();
+    buffer->threadId = ++numBuffers;
+    snprintf(buffer->threadName, sizeof(buffer->threadName), "thread %d", buffer->threadId);
+    buffer->next = allBuffers;
+    allBuffers = buffer;
+    pthread_mutex_unlock(&traceLock);
+
+    threadBuffer = buffer;
+    return buffer;
+}
+
+TraceScope traceBegin(const char* name) {
+    getThreadBuffer(); // Registering first keeps traceOrigin before every start
+    TraceScope scope = {name, traceNow()};
+    return scope;
+}
+
+void traceEnd(TraceScope* scope) {
+    uint64_t end = traceNow();
+    TraceBuffer* buffer = getThreadBuffer();
+    if (buffer == NULL) return;
+    pthread_mutex_lock(&buffer->lock);
+    TraceEvent* event = &buffer->events[buffer->count % TRACE_RING_SIZE];
+    event->name = scope->name;
+    event->start = scope->start;
+    event->duration = end - scope->start;
+    buffer->count++;
+    pthread_mutex_unlock(&buffer->lock);
+}
+
+void traceThreadName(const char* name) {
+    TraceBuffer* buffer = getThreadBuffer();
+    if (buffer == NULL) return;
+    pthread_mutex_lock(&buffer->lock);
+    snprintf(buffer->threadName, sizeof(buffer->threadName), "%s", name);
+    pthread_mutex_unlock(&buffer->lock);
+}
+
+int dumpTrace(const char* path) {
+    TraceEvent* copy = malloc(sizeof(TraceEvent) * TRACE_RING_SIZE);
+    if (copy == NULL) {
+        printf("Out of memory writing trace %s\n", path);
+        return -1;
+    }
+    FILE* out = fopen(path, "w");
+    if (out == NULL) {
+        printf("Could not open trace file %s for writing\n", path);
+        free(copy);
+        return -1;
+    }
+
+    // Buffers are never freed, so the list can be walked once its head is read
+    pthread_mutex_lock(&traceLock);
+    TraceBuffer* first = allBuffers;
+    uint64_t origin = traceOrigin;
+    pthread_mutex_unlock(&traceLock);
+
+    long long written = 0;
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (TraceBuffer* buffer = first; buffer != NULL; buffer = buffer->next) {
+        char threadName[32];
+
+        // Copy under the lock and write without it, so the owning thread
+        // is only held up for a copy
+        pthread_mutex_lock(&buffer->lock);
+        uint64_t count = buffer->count < TRACE_RING_SIZE ? buffer->count : TRACE_RING_SIZE;
+        uint64_t oldest = buffer->count - count;
+        for (uint64_t i = 0; i < count; i++) {
+            copy[i] = buffer->events[(oldest + i) % TRACE_RING_SIZE];
+        }
+        memcpy(threadName, buffer->threadName, sizeof(threadName));
+        pthread_mutex_unlock(&buffer->lock);
+
+        fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                written++ ? ",\n" : "", buffer->threadId, threadName);
+        for (uint64_t i = 0; i < count; i++) {
+            fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    copy[i].name, buffer->threadId, (copy[i].start - origin) / 1000.0, copy[i].duration / 1000.0);
+            written++;
+        }
+    }
+    fprintf(out, "\n]}\n");
+    free(copy);
+
+    if (fclose(out) != 0) {
+        printf("Error writing trace file %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+#endif // TRACE_ENABLED
@@ -0,0 +1,54 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// Scoped trace markers for finding where frame and turn time goes.
+// TRACE_SCOPE("name") times the rest of the enclosing block; the events
+// go to a ring buffer owned by the calling thread and can be written out
+// as a Chrome trace (open it in chrome://tracing or Perfetto).
+//
+// Built in with `make TRACE=1`, which defines TRACE_ENABLED. Without it
+// every macro expands to nothing, so markers cost nothing in normal builds.
+
+#define TRACE_FILE "trace.json"
+#define TRACE_RING_SIZE 65536 // Events kept per thread; older ones are overwritten
+
+#ifdef TRACE_ENABLED
+
+#include <stdint.h>
+
+typedef struct {
+    const char* name; // Must outlive the trace: use string literals
+    uint64_t start;   // Nanoseconds
+} TraceScope;
+
+TraceScope traceBegin(const char* name);
+void traceEnd(TraceScope* scope);
+
+// Label the calling thread in the trace viewer
+void traceThreadName(const char* name);
+
+// Write every thread's buffered events as Chrome trace JSON. Safe to call
+// while other threads are tracing. Returns 0 on success, -1 on error.
+int dumpTrace(const char* path);
+
+#define TRACE_JOIN2(a, b) a##b
+#define TRACE_JOIN(a, b) TRACE_JOIN2(a, b)
+#define TRACE_SCOPE(name) \
+    TraceScope TRACE_JOIN(traceScope, __LINE__) __attribute__((cleanup(traceEnd))) = traceBegin(name)
+#define TRACE_THREAD(name) traceThreadName(name)
+#define TRACE_DUMP(path) dumpTrace(path)
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_THREAD(name) ((void)0)
+#define TRACE_DUMP(path) dumpTrace(path)
+
+static inline int dumpTrace(const char* path) {
+    (void)path;
+    return -1; // Nothing was traced
+}
+
+#endif // TRACE_ENABLED
+
+#endif // TRACE_H
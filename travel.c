@@ -0,0 +1,94 @@
+#include <stddef.h>
+#include "path.h"
+#include "travel.h"
+
+// One map per kind of walk, and the target a TRAVEL_TILE map leads to
+static _Thread_local DistanceMap travelMaps[TRAVEL_KINDS];
+static _Thread_local int tileTargetX = -1;
+static _Thread_local int tileTargetY = -1;
+
+// An item the player knows about, or an explored tile next to unexplored
+// ones; walking onto either teaches the player something
+static int isExploreGoal(int x, int y, void* data) {
+    (void)data;
+    if (map[y][x] == '>') return 0;
+    if (map[y][x] == '!' || map[y][x] == 'F') return 1;
+    for (int d = 0; d < 4; d++) {
+        int nx = x + pathDirX[d];
+        int ny = y + pathDirY[d];
+        if (nx >= 0 && nx < MAP_WIDTH && ny >= 0 && ny < MAP_HEIGHT && !visibility[ny][nx]) return 1;
+    }
+    return 0;
+}
+
+static int isTarget(int x, int y, void* data) {
+    const int* target = data;
+    return x == target[0] && y == target[1];
+}
+
+// The walk's distance map, rebuilt only if the map, what has been
+// explored or the target changed since it was built
+static const DistanceMap* travelMap(const TravelCommand* travel) {
+    DistanceMap* distances = &travelMaps[travel->kind];
+    int target[2] = {travel->targetX, travel->targetY};
+    if (travel->kind == TRAVEL_TILE && (target[0] != tileTargetX || target[1] != tileTargetY)) {
+        distances->valid = 0;
+        tileTargetX = target[0];
+        tileTargetY = target[1];
+    }
+    if (distances->valid && distances->mapVersion == mapVersion) return distances;
+
+    if (travel->kind == TRAVEL_EXPLORE) {
+        buildDistanceMap(distances, isExploreGoal, NULL);
+    } else {
+        buildDistanceMap(distances, isTarget, target);
+    }
+    return distances;
+}
+
+int startTravel(TravelCommand* travel, TravelKind kind, int x, int y) {
+    Action action = {ACTION_MOVE, 0, 0};
+    int target[2] = {x, y};
+    if (kind == TRAVEL_STAIRS && !findKnownStairs(target)) {
+        showMessage("You haven't found the stairs yet.");
+        return 0;
+    }
+    if (kind == TRAVEL_TILE && (x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT || !visibility[y][x])) {
+        showMessage("You don't know what is there.");
+        return 0;
+    }
+    travel->kind = kind;
+    travel->targetX = target[0];
+    travel->targetY = target[1];
+    if (!startRepeat(&travel->repeat, action, 1)) return 0;
+
+    int distance = travelMap(travel)->distance[player.y][player.x];
+    if (distance == PATH_UNREACHABLE) {
+        showMessage(kind == TRAVEL_EXPLORE ? "There is nothing left to explore here." : "You don't know a way there.");
+        return 0;
+    }
+    return 1;
+}
+
+int nextTravelStep(TravelCommand* travel, Action* action) {
+    int dx, dy;
+    int distance = stepDownhill(travelMap(travel), player.x, player.y, &dx, &dy);
+    if (distance < 0) {
+        // Whatever was left got explored on the way
+        if (travel->kind == TRAVEL_EXPLORE) showMessage("There is nothing left to explore here.");
+        return 0;
+    }
+    if (travel->kind == TRAVEL_STAIRS && distance <= 1) {
+        showMessage("You reach the stairs.");
+        return 0;
+    }
+    if (distance == 0) {
+        // Explore goals are never reached: walking up to one explores it
+        if (travel->kind == TRAVEL_TILE) showMessage("You arrive.");
+        return 0;
+    }
+    action->type = ACTION_MOVE;
+    action->dx = dx;
+    action->dy = dy;
+    return 1;
+}
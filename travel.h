@@ -0,0 +1,36 @@
+#ifndef TRAVEL_H
+#define TRAVEL_H
+
+#include "game.h"
+
+// Auto-explore and travel: multi-turn walks that follow a distance map
+// (path.h) through explored tiles. The maps are kept between steps and
+// commands and only rebuilt when mapVersion changes, so most steps are a
+// lookup. A frontend plays a walk like the other repeat commands:
+//
+//   if (startTravel(&travel, TRAVEL_EXPLORE, 0, 0)) {
+//       while (nextTravelStep(&travel, &action)) {
+//           if (!continueRepeat(&travel.repeat, playTurn(action))) break;
+//       }
+//   }
+
+typedef enum {
+    TRAVEL_EXPLORE, // To the nearest unexplored edge or known item
+    TRAVEL_STAIRS,  // Next to the stairs, once they have been seen
+    TRAVEL_TILE,    // To an explored tile, such as one clicked on
+    TRAVEL_KINDS
+} TravelKind;
+
+typedef struct {
+    TravelKind kind;
+    int targetX, targetY; // TRAVEL_TILE
+    RepeatCommand repeat; // Stops on monsters in view and damage
+} TravelCommand;
+
+// Returns 0, with a message, if there is nowhere to go
+int startTravel(TravelCommand* travel, TravelKind kind, int x, int y);
+
+// The next step. Returns 0, with a message, once the walk has arrived.
+int nextTravelStep(TravelCommand* travel, Action* action);
+
+#endif // TRAVEL_H
@@ -0,0 +1,150 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "workpool.h"
+
+// Items a worker claims from its own slice at a time
+#define WORK_CHUNK 16
+
+typedef struct {
+    pthread_mutex_t lock;
+    long long next; // Owner takes from here
+    long long end;  // Thieves take from here
+} WorkSlice;
+
+typedef struct {
+    WorkSlice* slices;
+    int numWorkers;
+    WorkFunction work;
+    void* userData;
+} WorkPool;
+
+typedef struct {
+    WorkPool* pool;
+    int worker;
+} WorkerArgs;
+
+// Claim up to WORK_CHUNK items from the front of our own slice
+static int claimChunk(WorkSlice* slice, long long* first, long long* last) {
+    pthread_mutex_lock(&slice->lock);
+    *first = slice->next;
+    *last = slice->next + WORK_CHUNK < slice->end ? slice->next + WORK_CHUNK : slice->end;
+    slice->next = *last;
+    pthread_mutex_unlock(&slice->lock);
+    return *first < *last;
+}
+
+// Move the back half of the fullest other slice into ours
+static int stealWork(WorkPool* pool, int worker) {
+    while (1) {
+        int victim = -1;
+        long long most = 0;
+        for (int i = 0; i < pool->numWorkers; i++) {
+            WorkSlice* slice = &pool->slices[i];
+            long long remaining = slice->end - slice->next; // Racy read, only a hint
+            if (i != worker && remaining > most) {
+                most = remaining;
+                victim = i;
+            }
+        }
+        if (victim < 0) return 0; // Nothing left anywhere
+
+        WorkSlice* from = &pool->slices[victim];
+        long long first, last;
+        pthread_mutex_lock(&from->lock);
+        long long remaining = from->end - from->next;
+        if (remaining <= 0) {
+            pthread_mutex_unlock(&from->lock);
+            continue; // Emptied meanwhile, look again
+        }
+        last = from->end;
+        first = remaining > 1 ? from->end - remaining / 2 : from->next;
+        from->end = first;
+        pthread_mutex_unlock(&from->lock);
+
+        WorkSlice* to = &pool->slices[worker];
+        pthread_mutex_lock(&to->lock);
+        to->next = first;
+        to->end = last;
+        pthread_mutex_unlock(&to->lock);
+        return 1;
+    }
+}
+
+static void* workerMain(void* arg) {
+    WorkerArgs* args = arg;
+    WorkPool* pool = args->pool;
+    WorkSlice* own = &pool->slices[args->worker];
+    long long first, last;
+
+    do {
+        while (claimChunk(own, &first, &last)) {
+            for (long long item = first; item < last; item++) {
+                pool->work(item, args->worker, pool->userData);
+            }
+        }
+    } while (stealWork(pool, args->worker));
+    return NULL;
+}
+
+int runWorkStealing(long long first, long long last, int numWorkers, WorkFunction work, void* userData) {
+    if (numWorkers < 1) numWorkers = 1;
+    WorkPool pool = {calloc(numWorkers, sizeof(WorkSlice)), numWorkers, work, userData};
+    pthread_t* threads = calloc(numWorkers, sizeof(pthread_t));
+    WorkerArgs* args = calloc(numWorkers, sizeof(WorkerArgs));
+    if (pool.slices == NULL || threads == NULL || args == NULL) {
+        printf("Out of memory starting %d workers\n", numWorkers);
+        free(pool.slices);
+        free(threads);
+        free(args);
+        return -1;
+    }
+
+    long long count = last > first ? last - first : 0;
+    for (int i = 0; i < numWorkers; i++) {
+        pthread_mutex_init(&pool.slices[i].lock, NULL);
+        pool.slices[i].next = first + count * i / numWorkers;
+        pool.slices[i].end = first + count * (i + 1) / numWorkers;
+        args[i].pool = &pool;
+        args[i].worker = i;
+    }
+
+    int started = 0;
+    while (started < numWorkers && pthread_create(&threads[started], NULL, workerMain, &args[started]) == 0) {
+        started++;
+    }
+    // Running workers steal whatever the missing ones would have done
+    if (started < numWorkers) {
+        printf("Started only %d of %d worker threads\n", started, numWorkers);
+    }
+    if (started == 0) {
+        workerMain(&args[0]);
+    }
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (int i = 0; i < numWorkers; i++) {
+        pthread_mutex_destroy(&pool.slices[i].lock);
+    }
+    free(pool.slices);
+    free(threads);
+    free(args);
+    return 0;
+}
+
+int countProcessors() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
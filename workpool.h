@@ -0,0 +1,18 @@
+#ifndef WORKPOOL_H
+#define WORKPOOL_H
+
+// Called once per item; `worker` is 0..numWorkers-1 and is stable for the
+// calling thread, so callers can keep per-worker buffers.
+typedef void (*WorkFunction)(long long item, int worker, void* userData);
+
+// Run `work` over items [first, last) on `numWorkers` threads. Each
+// worker starts with an equal slice and takes small chunks from its
+// front; idle workers steal the back half of the largest remaining
+// slice. If threads can't be started the remaining ones (or the caller)
+// do the work. Returns 0 on success, -1 if out of memory.
+int runWorkStealing(long long first, long long last, int numWorkers, WorkFunction work, void* userData);
+
+// Number of online processors, at least 1
+int countProcessors();
+
+#endif // WORKPOOL_H